@@ -0,0 +1,77 @@
+/********************************************************************************
+ *  File Name:
+ *    trace.hpp
+ *
+ *  Description:
+ *    Scoped trace zones for kernel and application code. AK_TRACE_ZONE compiles
+ *    to nothing unless the build defines AEROKERNEL_TRACE, ie:
+ *    b2 bench define=AEROKERNEL_TRACE
+ *
+ *    With tracing enabled the build must link a recorder that provides now()
+ *    and record(). The host one lives in tst/fixtures/trace_recorder.cpp; a
+ *    target port supplies its own, ie backed by the DWT cycle counter.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef AEROKERNEL_TRACE_HPP
+#define AEROKERNEL_TRACE_HPP
+
+/* C++ Includes */
+#include <cstdint>
+
+namespace AeroKernel::Trace
+{
+  /**
+   *  Current time in nanoseconds relative to the recorder's epoch
+   *
+   *  @return uint64_t
+   */
+  uint64_t now();
+
+  /**
+   *  Stores a completed zone. Must be safe to call from any thread.
+   *
+   *  @param[in]  name      Zone name. Only the pointer is kept, so it must be a
+   *                        string literal or otherwise outlive the recorder.
+   *  @param[in]  startNs   Value of now() when the zone began
+   *  @param[in]  endNs     Value of now() when the zone ended
+   *  @return void
+   */
+  void record( const char *const name, const uint64_t startNs, const uint64_t endNs );
+
+  /**
+   *  Records the lifetime of the object as a zone
+   */
+  class Zone
+  {
+  public:
+    Zone( const char *const name ) : name( name ), start( now() )
+    {
+    }
+
+    ~Zone()
+    {
+      record( name, start, now() );
+    }
+
+    Zone( const Zone & ) = delete;
+    Zone &operator=( const Zone & ) = delete;
+
+  private:
+    const char *const name;
+    const uint64_t start;
+  };
+}  // namespace AeroKernel::Trace
+
+#define AK_TRACE_CONCAT_IMPL( a, b ) a##b
+#define AK_TRACE_CONCAT( a, b ) AK_TRACE_CONCAT_IMPL( a, b )
+
+#if defined( AEROKERNEL_TRACE )
+#define AK_TRACE_ZONE( name ) ::AeroKernel::Trace::Zone AK_TRACE_CONCAT( ak_trace_zone_, __LINE__ )( name )
+#else
+#define AK_TRACE_ZONE( name )
+#endif
+
+#endif /* !AEROKERNEL_TRACE_HPP */
@@ -0,0 +1,88 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_boot.cpp
+ *
+ *  Description:
+ *    Boot-to-ready cost of bringing up a parameter store on slow storage. 2000
+ *    parameters live on the SPI F-RAM model; the eager case loads every one of
+ *    them at boot, the first-access case only touches the few needed to fly.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+#include <fixtures/fram_device_model.hpp>
+#include <fixtures/virtual_memory_fixture.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+static constexpr size_t BootParameters    = 2000;
+static constexpr size_t BootHotParameters = 20;
+
+/**
+ *  Brings up a fresh manager, registers every parameter and then reads the
+ *  first loadCount of them, timing each registration and read.
+ */
+static void boot( Context &ctx, const std::string &name, const std::vector<std::string> &keys, const size_t loadCount )
+{
+  using namespace std::chrono;
+
+  resetVirtualMemory();
+  auto fram = std::make_shared<FRAMDeviceModel>( ExternalSRAM2_VMD );
+
+  auto bootStart = steady_clock::now();
+
+  Manager mgr;
+  mgr.init( keys.size() );
+  mgr.registerMemoryDriver( StorageType::EXTERNAL_FLASH0, fram );
+
+  const auto registrations = timeEach( keys.size(), [ & ]( const size_t i ) {
+    const size_t address = i * sizeof( uint32_t );
+    mgr.registerParameter( keys[ i ], buildControlBlock( address, sizeof( uint32_t ), StorageType::EXTERNAL_FLASH0 ) );
+  } );
+
+  uint32_t value   = 0;
+  const auto loads = timeEach( loadCount, [ & ]( const size_t i ) { mgr.read( keys[ i ], &value ); } );
+
+  const auto hostNs = duration_cast<nanoseconds>( steady_clock::now() - bootStart ).count();
+  const auto bus    = fram->getBusStats();
+
+  /*------------------------------------------------
+  Registration and load are different operations, so each gets its own
+  latency distribution. The whole boot is summarized on the load result.
+  ------------------------------------------------*/
+  auto &registered = ctx.record( name + "/register", registrations );
+  Context::counter( registered, "parameters", static_cast<double>( keys.size() ) );
+
+  auto &loaded = ctx.record( name + "/load", loads );
+  Context::counter( loaded, "loaded", static_cast<double>( loadCount ) );
+  Context::counter( loaded, "host_boot_us", hostNs / 1.0e3 );
+  Context::counter( loaded, "bus_boot_us", bus.busTimeNs / 1.0e3 );
+  Context::counter( loaded, "ready_us", ( hostNs + bus.busTimeNs ) / 1.0e3 );
+}
+
+AEROKERNEL_BENCHMARK( ParameterBoot )
+{
+  std::vector<std::string> keys;
+  keys.reserve( BootParameters );
+
+  for ( size_t i = 0; i < BootParameters; i++ )
+  {
+    keys.push_back( "boot_param_" + std::to_string( i ) );
+  }
+
+  boot( ctx, "boot/eager_load", keys, BootParameters );
+  boot( ctx, "boot/hot_set_only", keys, BootHotParameters );
+}
@@ -0,0 +1,200 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_change_stream.cpp
+ *
+ *  Description:
+ *    Streams parameter writes through a shared memory ring to a local client and
+ *    reports the latency from write to receipt, the client throughput and the
+ *    cost the stream adds to each Manager write. Records are published in
+ *    batches, as a simulation publishing once per tick would.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#if !defined( _WIN32 )
+
+/* C++ Includes */
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* POSIX Includes */
+#include <unistd.h>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+#include <fixtures/change_stream.hpp>
+#include <fixtures/virtual_memory_fixture.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+static std::string ringPath()
+{
+  /*------------------------------------------------
+  Prefer a RAM backed file so page cache writeback stays out of the numbers
+  ------------------------------------------------*/
+  const std::string directory = ( access( "/dev/shm", W_OK ) == 0 ) ? "/dev/shm" : "/tmp";
+  return directory + "/aerokernel_bench_stream_" + std::to_string( getpid() );
+}
+
+static uint64_t steadyNowNs()
+{
+  using namespace std::chrono;
+  return static_cast<uint64_t>( duration_cast<nanoseconds>( steady_clock::now().time_since_epoch() ).count() );
+}
+
+static void streamWithPolicy( Context &ctx, const std::string &label, const ChangeStream::Backpressure policy )
+{
+  static constexpr size_t ringCapacity = 1024;
+  static constexpr size_t clientBatch  = 64;
+  static constexpr size_t publishBatch = 16;
+
+  const std::string path = ringPath();
+  const auto channel     = static_cast<uint32_t>( StorageType::INTERNAL_SRAM );
+
+  resetVirtualMemory();
+
+  auto writer = std::make_shared<ChangeStream::Writer>();
+  if ( !writer->open( path, ringCapacity, policy ) )
+  {
+    return;
+  }
+  writer->setBatchSize( publishBatch );
+
+  Manager mgr;
+  mgr.init( 2 );
+  mgr.registerMemoryDriver( StorageType::INTERNAL_SRAM,
+                            std::make_shared<ChangeStreamDevice>( InternalSRAM_VMD, writer, channel ) );
+  mgr.registerParameter( "value", buildControlBlock( 0, sizeof( uint32_t ), StorageType::INTERNAL_SRAM ) );
+
+  /*------------------------------------------------
+  The client maps the ring through its own Reader, exactly as a separate
+  process would, and timestamps each record as it comes off the ring.
+  ------------------------------------------------*/
+  const size_t writes = ctx.iterations();
+  std::atomic<bool> clientReady( false );
+  std::atomic<bool> producerDone( false );
+  std::vector<uint64_t> latencies;
+  latencies.reserve( writes );
+
+  ChangeStream::Reader reader;
+  if ( !reader.open( path ) )
+  {
+    unlink( path.c_str() );
+    return;
+  }
+
+  std::thread client( [ & ]() {
+    std::array<ChangeStream::Record, clientBatch> batch;
+    clientReady.store( true, std::memory_order_release );
+
+    while ( true )
+    {
+      const bool finished = producerDone.load( std::memory_order_acquire );
+      const size_t count  = reader.poll( batch.data(), batch.size() );
+      const uint64_t now  = steadyNowNs();
+
+      for ( size_t x = 0; x < count; x++ )
+      {
+        latencies.push_back( now - batch[ x ].timestampNs );
+      }
+
+      if ( !count )
+      {
+        if ( finished )
+        {
+          break;
+        }
+
+        std::this_thread::yield();
+      }
+    }
+  } );
+
+  while ( !clientReady.load( std::memory_order_acquire ) )
+  {
+    std::this_thread::yield();
+  }
+
+  const uint64_t start = steadyNowNs();
+  for ( size_t x = 0; x < writes; x++ )
+  {
+    const uint32_t value = static_cast<uint32_t>( x );
+    mgr.write( "value", &value );
+  }
+  writer->publish();
+  producerDone.store( true, std::memory_order_release );
+  client.join();
+
+  const double elapsedSec = static_cast<double>( steadyNowNs() - start ) / 1e9;
+  auto &result            = ctx.record( "stream/" + label + "/write_to_client", latencies );
+
+  Context::counter( result, "records_received", static_cast<double>( latencies.size() ) );
+  Context::counter( result, "records_dropped", static_cast<double>( reader.dropped() ) );
+  Context::counter( result, "client_records_per_sec", elapsedSec > 0.0 ? latencies.size() / elapsedSec : 0.0 );
+  Context::counter( result, "publish_batch", static_cast<double>( publishBatch ) );
+
+  reader.close();
+  writer->close();
+  unlink( path.c_str() );
+}
+
+AEROKERNEL_BENCHMARK( ParameterChangeStream )
+{
+  /*------------------------------------------------
+  Baseline: what a Manager write costs with nothing listening
+  ------------------------------------------------*/
+  resetVirtualMemory();
+
+  Manager plain;
+  plain.init( 2 );
+  plain.registerMemoryDriver( StorageType::INTERNAL_SRAM, InternalSRAM_VMD );
+  plain.registerParameter( "value", buildControlBlock( 0, sizeof( uint32_t ), StorageType::INTERNAL_SRAM ) );
+
+  auto &baseline = ctx.measure( "stream/manager_write/unstreamed", [ & ]( const size_t i ) {
+    const uint32_t value = static_cast<uint32_t>( i );
+    return plain.write( "value", &value );
+  } );
+
+  /*------------------------------------------------
+  Same write with the stream attached but no client draining it, so the
+  ring fills and every further record takes the cheap drop path
+  ------------------------------------------------*/
+  const std::string path = ringPath();
+  auto writer            = std::make_shared<ChangeStream::Writer>();
+
+  if ( writer->open( path, 1024, ChangeStream::Backpressure::DROP_NEWEST ) )
+  {
+    resetVirtualMemory();
+
+    Manager streamed;
+    streamed.init( 2 );
+    streamed.registerMemoryDriver( StorageType::INTERNAL_SRAM,
+                                   std::make_shared<ChangeStreamDevice>( InternalSRAM_VMD, writer, 0 ) );
+    streamed.registerParameter( "value", buildControlBlock( 0, sizeof( uint32_t ), StorageType::INTERNAL_SRAM ) );
+
+    auto &overhead = ctx.measure( "stream/manager_write/streamed_ring_full", [ & ]( const size_t i ) {
+      const uint32_t value = static_cast<uint32_t>( i );
+      return streamed.write( "value", &value );
+    } );
+
+    Context::counter( overhead, "p50_vs_unstreamed", baseline.p50Ns ? ( overhead.p50Ns / baseline.p50Ns ) : 0.0 );
+
+    writer->close();
+    unlink( path.c_str() );
+  }
+
+  streamWithPolicy( ctx, "block", ChangeStream::Backpressure::BLOCK );
+  streamWithPolicy( ctx, "drop_newest", ChangeStream::Backpressure::DROP_NEWEST );
+}
+
+#endif /* !_WIN32 */
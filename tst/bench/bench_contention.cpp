@@ -0,0 +1,94 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_contention.cpp
+ *
+ *  Description:
+ *    Checks whether a slow storage device holds up access to fast ones. Reads of
+ *    an INTERNAL_SRAM parameter are timed alone and then again while another
+ *    thread keeps a real time F-RAM model busy through the same Manager.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+#include <fixtures/fram_device_model.hpp>
+#include <fixtures/virtual_memory_fixture.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+AEROKERNEL_BENCHMARK( SlowDeviceContention )
+{
+  /*------------------------------------------------
+  A 1 KB write at 8 MHz holds the F-RAM bus for about a millisecond,
+  which is the kind of stall that must not leak onto SRAM readers.
+  ------------------------------------------------*/
+  static constexpr size_t slowSize = 1024;
+
+  resetVirtualMemory();
+
+  FRAMDeviceModel::Timing timing;
+  timing.realTime = true;
+
+  auto fram = std::make_shared<FRAMDeviceModel>( ExternalSRAM2_VMD, timing );
+
+  Manager mgr;
+  mgr.init( 2 );
+  mgr.registerMemoryDriver( StorageType::INTERNAL_SRAM, InternalSRAM_VMD );
+  mgr.registerMemoryDriver( StorageType::EXTERNAL_FLASH0, fram );
+  mgr.registerParameter( "fast", buildControlBlock( 0, sizeof( uint32_t ), StorageType::INTERNAL_SRAM ) );
+  mgr.registerParameter( "slow", buildControlBlock( 0, slowSize, StorageType::EXTERNAL_FLASH0 ) );
+
+  uint32_t fastValue = 0;
+  auto &idle = ctx.measure( "contention/sram_read/idle", [ & ]( const size_t ) { return mgr.read( "fast", &fastValue ); } );
+
+  /*------------------------------------------------
+  Keep reading until the writer has completed a fixed number of slow
+  writes, so the timed window always overlaps the stalls.
+  ------------------------------------------------*/
+  static constexpr uint64_t slowWrites = 50;
+
+  std::atomic<uint64_t> completedWrites( 0 );
+  std::thread slowWriter( [ & ]() {
+    std::array<uint8_t, slowSize> slowValue;
+    slowValue.fill( 0x77 );
+
+    while ( completedWrites.load( std::memory_order_relaxed ) < slowWrites )
+    {
+      mgr.write( "slow", slowValue.data() );
+      completedWrites.fetch_add( 1, std::memory_order_relaxed );
+    }
+  } );
+
+  std::vector<uint64_t> samples;
+  samples.reserve( ctx.iterations() );
+
+  while ( completedWrites.load( std::memory_order_relaxed ) < slowWrites )
+  {
+    using namespace std::chrono;
+
+    auto start = steady_clock::now();
+    mgr.read( "fast", &fastValue );
+    samples.push_back( static_cast<uint64_t>( duration_cast<nanoseconds>( steady_clock::now() - start ).count() ) );
+  }
+
+  slowWriter.join();
+  auto &loaded = ctx.record( "contention/sram_read/slow_device_busy", samples );
+
+  Context::counter( loaded, "slow_device_writes", static_cast<double>( slowWrites ) );
+  Context::counter( loaded, "p99_slowdown", idle.p99Ns ? ( loaded.p99Ns / idle.p99Ns ) : 0.0 );
+  Context::counter( loaded, "max_slowdown", idle.maxNs ? ( loaded.maxNs / idle.maxNs ) : 0.0 );
+}
@@ -0,0 +1,123 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_faults.cpp
+ *
+ *  Description:
+ *    Measures how Manager read/write throughput and tail latency degrade when
+ *    the storage device under a parameter misbehaves. Every scenario uses the
+ *    same seed so runs are directly comparable.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+#include <fixtures/fault_injecting_device.hpp>
+#include <fixtures/virtual_memory_fixture.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+static constexpr uint64_t FaultSeed = 0x5EED;
+
+/**
+ *  Attaches the faults common to reads and writes
+ */
+static void addInjectedCounts( Result &result, const FaultInjectingDevice::InjectedCounts &counts )
+{
+  Context::counter( result, "injected_stalls", static_cast<double>( counts.stalls ) );
+  Context::counter( result, "injected_bit_flips", static_cast<double>( counts.bitFlips ) );
+  Context::counter( result, "injected_partial_transfers", static_cast<double>( counts.partialTransfers ) );
+}
+
+/**
+ *  Runs one fault configuration and compares it against the clean run
+ *
+ *  @return std::pair<const Result *, const Result *>   The write and read results
+ */
+static std::pair<const Result *, const Result *> runScenario( Context &ctx, const std::string &label,
+                                                             const FaultInjectingDevice::Faults &faults,
+                                                             const Result *cleanWrite, const Result *cleanRead )
+{
+  resetVirtualMemory();
+
+  auto faulty = std::make_shared<FaultInjectingDevice>( ExternalSRAM0_VMD, faults );
+
+  Manager mgr;
+  mgr.init( 2 );
+  mgr.registerMemoryDriver( StorageType::EXTERNAL_SRAM0, faulty );
+  mgr.registerParameter( "value", buildControlBlock( 0, 64, StorageType::EXTERNAL_SRAM0 ) );
+
+  std::array<uint8_t, 64> value;
+  value.fill( 0x3C );
+
+  /*------------------------------------------------
+  Counts are taken after each phase so every result only reports the
+  faults injected into its own calls
+  ------------------------------------------------*/
+  auto &write = ctx.measure( "faults/" + label + "/write", [ & ]( const size_t ) { return mgr.write( "value", value.data() ); } );
+  const auto writeCounts = faulty->getInjectedCounts();
+  addInjectedCounts( write, writeCounts );
+  Context::counter( write, "injected_failed_writes", static_cast<double>( writeCounts.failedWrites ) );
+
+  faulty->resetCounts();
+  auto &read = ctx.measure( "faults/" + label + "/read", [ & ]( const size_t ) { return mgr.read( "value", value.data() ); } );
+  addInjectedCounts( read, faulty->getInjectedCounts() );
+
+  if ( cleanWrite && cleanWrite->p99Ns )
+  {
+    Context::counter( write, "p99_vs_clean", write.p99Ns / cleanWrite->p99Ns );
+    Context::counter( write, "throughput_vs_clean", cleanWrite->opsPerSec ? ( write.opsPerSec / cleanWrite->opsPerSec ) : 0.0 );
+  }
+
+  if ( cleanRead && cleanRead->p99Ns )
+  {
+    Context::counter( read, "p99_vs_clean", read.p99Ns / cleanRead->p99Ns );
+    Context::counter( read, "throughput_vs_clean", cleanRead->opsPerSec ? ( read.opsPerSec / cleanRead->opsPerSec ) : 0.0 );
+  }
+
+  return { &write, &read };
+}
+
+AEROKERNEL_BENCHMARK( ParameterFaultDegradation )
+{
+  FaultInjectingDevice::Faults clean;
+  clean.seed = FaultSeed;
+
+  auto cleanResults      = runScenario( ctx, "clean", clean, nullptr, nullptr );
+  const Result *cleanWrite = cleanResults.first;
+  const Result *cleanRead  = cleanResults.second;
+
+  FaultInjectingDevice::Faults latency = clean;
+  latency.latencyNs                    = 1000;
+  latency.latencyJitterNs              = 2000;
+  runScenario( ctx, "latency_1us_jitter_2us", latency, cleanWrite, cleanRead );
+
+  FaultInjectingDevice::Faults stalls = clean;
+  stalls.stallProbability             = 0.01;
+  stalls.stallNs                      = 50000;
+  runScenario( ctx, "stall_1pct_50us", stalls, cleanWrite, cleanRead );
+
+  FaultInjectingDevice::Faults flips = clean;
+  flips.readBitFlipProbability       = 0.01;
+  flips.writeBitFlipProbability      = 0.01;
+  runScenario( ctx, "bit_flip_1pct", flips, cleanWrite, cleanRead );
+
+  FaultInjectingDevice::Faults failures = clean;
+  failures.writeFailureProbability      = 0.01;
+  runScenario( ctx, "write_fail_1pct", failures, cleanWrite, cleanRead );
+
+  FaultInjectingDevice::Faults partial = clean;
+  partial.partialTransferProbability   = 0.01;
+  runScenario( ctx, "partial_1pct", partial, cleanWrite, cleanRead );
+}
@@ -0,0 +1,162 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_footprint.cpp
+ *
+ *  Description:
+ *    Memory cost of the parameter registry and how cache friendly its lookups
+ *    are. Tracks the bytes spent per registered parameter and the last level
+ *    cache miss rate of lookups over a registry larger than the cache, then the
+ *    heap footprint at the sizes ParameterScale times.
+ *
+ *    Built into AeroKernelFootprint with the heap tracker, so every result here
+ *    only carries counters. The matching latencies come from ParameterScale in
+ *    AeroKernelBench.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+#include "heap_tracker.hpp"
+#include "perf_counters.hpp"
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+/**
+ *  Large enough that the registry does not fit in a typical host L2 cache
+ */
+static constexpr size_t FootprintKeys = 100000;
+
+/**
+ *  Same sizes as ParameterScale in AeroKernelBench
+ */
+static constexpr std::array<size_t, 3> ScaleSizes = { 10000, 100000, 1000000 };
+static_assert( ScaleSizes.back() <= SyntheticNameSpace, "Not enough unique synthetic names" );
+
+AEROKERNEL_BENCHMARK( ParameterFootprint )
+{
+  std::vector<std::string> keys;
+  keys.reserve( FootprintKeys );
+  for ( size_t i = 0; i < FootprintKeys; i++ )
+  {
+    keys.push_back( "subsystem/param_" + std::to_string( i ) );
+  }
+
+  const ControlBlock cb = buildControlBlock( 0, sizeof( uint32_t ), StorageType::INTERNAL_SRAM );
+
+  /*------------------------------------------------
+  Heap used by init() and then by each registration
+  ------------------------------------------------*/
+  const auto beforeInit = Heap::snapshot();
+  auto mgr              = std::make_unique<Manager>();
+  mgr->init( FootprintKeys );
+  const auto afterInit = Heap::snapshot();
+
+  for ( const auto &key : keys )
+  {
+    mgr->registerParameter( key, cb );
+  }
+  const auto afterRegister = Heap::snapshot();
+
+  const double registeredBytes = static_cast<double>( afterRegister.liveBytes - afterInit.liveBytes );
+  const double totalBytes      = static_cast<double>( afterRegister.liveBytes - beforeInit.liveBytes );
+
+  auto &footprint = ctx.report( "footprint/heap" );
+  Context::counter( footprint, "parameters", FootprintKeys );
+  Context::counter( footprint, "control_block_bytes", sizeof( ControlBlock ) );
+
+  if ( Heap::isAvailable() )
+  {
+    Context::counter( footprint, "init_heap_bytes", static_cast<double>( afterInit.liveBytes - beforeInit.liveBytes ) );
+    Context::counter( footprint, "heap_bytes_per_param", registeredBytes / FootprintKeys );
+    Context::counter( footprint, "total_bytes_per_param", totalBytes / FootprintKeys );
+    Context::counter( footprint, "allocations_per_param",
+                      static_cast<double>( afterRegister.allocations - afterInit.allocations ) / FootprintKeys );
+  }
+
+  /*------------------------------------------------
+  Lookups in a shuffled order so each one lands on a cold part of the
+  table, with the cache miss rate if the host exposes the counters. The
+  loop is not timed; scale/100000/lookup/hit in AeroKernelBench is the
+  latency of the same access pattern.
+  ------------------------------------------------*/
+  std::vector<size_t> order( FootprintKeys );
+  for ( size_t i = 0; i < FootprintKeys; i++ )
+  {
+    order[ i ] = i;
+  }
+  std::shuffle( order.begin(), order.end(), std::mt19937( 0xAE50 ) );
+
+  size_t hits = 0;
+
+  CacheCounters cache;
+  cache.start();
+  for ( const size_t index : order )
+  {
+    hits += mgr->isRegistered( keys[ index ] ) ? 1u : 0u;
+  }
+  cache.stop();
+
+  auto &lookup    = ctx.report( "footprint/lookup/random" );
+  lookup.failures = FootprintKeys - hits;
+
+  if ( cache.isAvailable() && cache.references() )
+  {
+    Context::counter( lookup, "cache_misses_per_op", static_cast<double>( cache.misses() ) / FootprintKeys );
+    Context::counter( lookup, "cache_miss_rate", static_cast<double>( cache.misses() ) / cache.references() );
+  }
+}
+
+AEROKERNEL_BENCHMARK( ParameterScaleFootprint )
+{
+  const ControlBlock cb = buildControlBlock( 0, sizeof( uint32_t ), StorageType::INTERNAL_SRAM );
+
+  if ( !Heap::isAvailable() )
+  {
+    return;
+  }
+
+  for ( const size_t size : ScaleSizes )
+  {
+    std::vector<std::string> keys;
+    keys.reserve( size );
+    for ( size_t i = 0; i < size; i++ )
+    {
+      keys.push_back( syntheticName( i ) );
+    }
+
+    /*------------------------------------------------
+    Steady state heap footprint of a presized table
+    ------------------------------------------------*/
+    const auto beforeInit = Heap::snapshot();
+    auto mgr              = std::make_unique<Manager>();
+    mgr->init( size );
+    const auto afterInit = Heap::snapshot();
+
+    for ( const auto &key : keys )
+    {
+      mgr->registerParameter( key, cb );
+    }
+    const auto afterRegister = Heap::snapshot();
+
+    const double heapBytes = static_cast<double>( afterRegister.liveBytes - beforeInit.liveBytes );
+
+    auto &result = ctx.report( "scale/" + std::to_string( size ) + "/heap" );
+    Context::counter( result, "heap_bytes_per_param", heapBytes / size );
+    Context::counter( result, "init_heap_bytes", static_cast<double>( afterInit.liveBytes - beforeInit.liveBytes ) );
+    Context::counter( result, "heap_mb", heapBytes / ( 1024.0 * 1024.0 ) );
+  }
+}
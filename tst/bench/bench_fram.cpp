@@ -0,0 +1,122 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_fram.cpp
+ *
+ *  Description:
+ *    Parameter Manager throughput against the SPI F-RAM timing model. Host time
+ *    only reflects software overhead; the bus_* counters are the modelled cost on
+ *    the MB85RS64V at 8 MHz and are what batching/caching changes should move.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <array>
+#include <string>
+#include <vector>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+#include <fixtures/fram_device_model.hpp>
+#include <fixtures/virtual_memory_fixture.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+static constexpr std::array<size_t, 5> FRAMTransferSizes = { 1, 16, 64, 256, 1024 };
+
+static void addBusCounters( Result &result, const FRAMDeviceModel::BusStats &stats )
+{
+  const double calls = static_cast<double>( result.calls );
+
+  Context::counter( result, "bus_ns_per_op", stats.busTimeNs / calls );
+  Context::counter( result, "bus_transactions_per_op", stats.transactions / calls );
+  Context::counter( result, "bus_bytes_per_op", stats.busBytes / calls );
+  Context::counter( result, "bus_effective_bytes_per_sec", stats.effectiveThroughput() );
+}
+
+static void registerFRAMParameter( Manager &mgr, const std::string &key, const size_t address, const size_t size )
+{
+  mgr.registerParameter( key, buildControlBlock( address, size, StorageType::EXTERNAL_FLASH0 ) );
+}
+
+/*------------------------------------------------
+Single parameter read/write cost across transfer sizes
+------------------------------------------------*/
+AEROKERNEL_BENCHMARK( FRAMReadWrite )
+{
+  resetVirtualMemory();
+
+  std::array<uint8_t, FRAMTransferSizes.back()> buffer;
+  buffer.fill( 0x3C );
+
+  auto fram = std::make_shared<FRAMDeviceModel>( ExternalSRAM2_VMD );
+
+  Manager mgr;
+  mgr.init( FRAMTransferSizes.size() );
+  mgr.registerMemoryDriver( StorageType::EXTERNAL_FLASH0, fram );
+
+  for ( const auto size : FRAMTransferSizes )
+  {
+    const std::string key = "fram_" + std::to_string( size );
+    registerFRAMParameter( mgr, key, 0, size );
+
+    fram->resetCounters();
+    auto &write = ctx.measure( "fram/write/" + std::to_string( size ), [ & ]( const size_t ) { return mgr.write( key, buffer.data() ); } );
+    addBusCounters( write, fram->getBusStats() );
+
+    fram->resetCounters();
+    auto &read = ctx.measure( "fram/read/" + std::to_string( size ), [ & ]( const size_t ) { return mgr.read( key, buffer.data() ); } );
+    addBusCounters( read, fram->getBusStats() );
+  }
+}
+
+/*------------------------------------------------
+The same 256 bytes moved as sixteen 16 byte parameters versus one 256
+byte parameter, showing what per-transaction overhead costs.
+------------------------------------------------*/
+AEROKERNEL_BENCHMARK( FRAMBatching )
+{
+  static constexpr size_t fieldSize  = 16;
+  static constexpr size_t fieldCount = 16;
+
+  resetVirtualMemory();
+
+  std::array<uint8_t, fieldSize * fieldCount> buffer;
+  buffer.fill( 0xC3 );
+
+  auto fram = std::make_shared<FRAMDeviceModel>( ExternalSRAM2_VMD );
+
+  Manager mgr;
+  mgr.init( fieldCount + 1 );
+  mgr.registerMemoryDriver( StorageType::EXTERNAL_FLASH0, fram );
+
+  std::vector<std::string> fieldKeys;
+  for ( size_t i = 0; i < fieldCount; i++ )
+  {
+    fieldKeys.push_back( "field_" + std::to_string( i ) );
+    registerFRAMParameter( mgr, fieldKeys.back(), i * fieldSize, fieldSize );
+  }
+
+  const std::string blockKey = "block";
+  registerFRAMParameter( mgr, blockKey, 0, buffer.size() );
+
+  fram->resetCounters();
+  auto &unbatched = ctx.measure( "fram/write/16x16", [ & ]( const size_t ) {
+    bool ok = true;
+    for ( size_t i = 0; i < fieldCount; i++ )
+    {
+      ok &= mgr.write( fieldKeys[ i ], buffer.data() + ( i * fieldSize ) );
+    }
+    return ok;
+  } );
+  addBusCounters( unbatched, fram->getBusStats() );
+
+  fram->resetCounters();
+  auto &batched = ctx.measure( "fram/write/1x256", [ & ]( const size_t ) { return mgr.write( blockKey, buffer.data() ); } );
+  addBusCounters( batched, fram->getBusStats() );
+}
@@ -0,0 +1,214 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_harness.cpp
+ *
+ *  Description:
+ *    Minimal benchmark harness for AeroKernel
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <iterator>
+#include <numeric>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+
+namespace AeroKernel::Bench
+{
+  /**
+   *  Function local so benchmarks in other translation units can register safely
+   *  during static initialization.
+   */
+  static std::vector<std::pair<std::string, BenchmarkFunc>> &registry()
+  {
+    static std::vector<std::pair<std::string, BenchmarkFunc>> benchmarks;
+    return benchmarks;
+  }
+
+  static void writeString( std::ostream &stream, const std::string &str )
+  {
+    stream << '"';
+    for ( const char c : str )
+    {
+      const unsigned char ch = static_cast<unsigned char>( c );
+
+      if ( ( ch == '"' ) || ( ch == '\\' ) )
+      {
+        stream << '\\' << c;
+      }
+      else if ( ch < 0x20 )
+      {
+        char escaped[ 8 ];
+        snprintf( escaped, sizeof( escaped ), "\\u%04x", ch );
+        stream << escaped;
+      }
+      else
+      {
+        stream << c;
+      }
+    }
+    stream << '"';
+  }
+
+  /**
+   *  JSON has no NaN or infinity, so those are written as null
+   */
+  static void writeNumber( std::ostream &stream, const double value )
+  {
+    if ( std::isfinite( value ) )
+    {
+      stream << value;
+    }
+    else
+    {
+      stream << "null";
+    }
+  }
+
+  Context::Context( const size_t iterations, std::deque<Result> &results ) :
+      defaultIterations( iterations ), results( results )
+  {
+  }
+
+  Result &Context::record( const std::string &name, const std::vector<uint64_t> &samplesNs )
+  {
+    samples = samplesNs;
+    return summarize( name, 0, samples.size() );
+  }
+
+  Result &Context::report( const std::string &name )
+  {
+    samples.clear();
+    return summarize( name, 0, 0 );
+  }
+
+  Result &Context::summarize( const std::string &name, const size_t failures, const size_t calls )
+  {
+    Result result;
+    result.name       = name;
+    result.iterations = samples.size();
+    result.calls      = calls;
+    result.failures   = failures;
+    result.minNs      = 0.0;
+    result.meanNs     = 0.0;
+    result.p50Ns      = 0.0;
+    result.p99Ns      = 0.0;
+    result.maxNs      = 0.0;
+    result.opsPerSec  = 0.0;
+
+    if ( !samples.empty() )
+    {
+      std::sort( samples.begin(), samples.end() );
+
+      const double total = static_cast<double>( std::accumulate( samples.begin(), samples.end(), uint64_t( 0 ) ) );
+      const size_t count = samples.size();
+
+      result.minNs  = static_cast<double>( samples.front() );
+      result.maxNs  = static_cast<double>( samples.back() );
+      result.meanNs = total / count;
+      result.p50Ns  = static_cast<double>( samples[ count / 2 ] );
+      result.p99Ns  = static_cast<double>( samples[ std::min( count - 1, ( count * 99 ) / 100 ) ] );
+
+      if ( result.meanNs > 0.0 )
+      {
+        result.opsPerSec = 1.0e9 / result.meanNs;
+      }
+    }
+
+    results.push_back( result );
+    return results.back();
+  }
+
+  void Context::counter( Result &result, const std::string &name, const double value )
+  {
+    result.counters.emplace_back( name, value );
+  }
+
+  size_t Context::iterations() const
+  {
+    return defaultIterations;
+  }
+
+  bool registerBenchmark( const std::string_view name, BenchmarkFunc func )
+  {
+    registry().emplace_back( std::string( name ), func );
+    return true;
+  }
+
+  std::vector<Result> runBenchmarks( const std::string_view filter, const size_t iterations )
+  {
+    std::deque<Result> results;
+    Context ctx( iterations, results );
+
+    for ( auto &benchmark : registry() )
+    {
+      if ( filter.empty() || ( benchmark.first.find( filter ) != std::string::npos ) )
+      {
+        benchmark.second( ctx );
+      }
+    }
+
+    return std::vector<Result>( results.begin(), results.end() );
+  }
+
+  void writeJSON( std::ostream &stream, const std::vector<Result> &results )
+  {
+    stream << std::fixed << std::setprecision( 3 );
+    stream << "{\n  \"suite\": \"AeroKernelBench\",\n  \"results\": [";
+
+    for ( size_t i = 0; i < results.size(); i++ )
+    {
+      const Result &r = results[ i ];
+
+      stream << ( i ? ",\n" : "\n" ) << "    {\n      \"name\": ";
+      writeString( stream, r.name );
+      stream << ",\n      \"iterations\": " << r.iterations;
+      stream << ",\n      \"calls\": " << r.calls;
+      stream << ",\n      \"failures\": " << r.failures;
+
+      /*------------------------------------------------
+      Counter only results have nothing to summarize
+      ------------------------------------------------*/
+      if ( r.iterations )
+      {
+        const std::pair<const char *, double> latencies[] = {
+          { "min", r.minNs }, { "mean", r.meanNs }, { "p50", r.p50Ns }, { "p99", r.p99Ns }, { "max", r.maxNs }
+        };
+
+        stream << ",\n      \"ns_per_op\": { ";
+        for ( size_t l = 0; l < std::size( latencies ); l++ )
+        {
+          stream << ( l ? ", \"" : "\"" ) << latencies[ l ].first << "\": ";
+          writeNumber( stream, latencies[ l ].second );
+        }
+        stream << " }";
+
+        stream << ",\n      \"ops_per_sec\": ";
+        writeNumber( stream, r.opsPerSec );
+      }
+
+      if ( !r.counters.empty() )
+      {
+        stream << ",\n      \"counters\": { ";
+        for ( size_t c = 0; c < r.counters.size(); c++ )
+        {
+          stream << ( c ? ", " : "" );
+          writeString( stream, r.counters[ c ].first );
+          stream << ": ";
+          writeNumber( stream, r.counters[ c ].second );
+        }
+        stream << " }";
+      }
+
+      stream << "\n    }";
+    }
+
+    stream << "\n  ]\n}\n";
+  }
+}  // namespace AeroKernel::Bench
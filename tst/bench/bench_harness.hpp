@@ -0,0 +1,226 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_harness.hpp
+ *
+ *  Description:
+ *    Minimal benchmark harness for AeroKernel. Benchmarks register themselves at
+ *    static initialization time and report per-operation latency statistics that
+ *    are emitted as JSON so separate runs can be diffed.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef AEROKERNEL_BENCH_HARNESS_HPP
+#define AEROKERNEL_BENCH_HARNESS_HPP
+
+/* C++ Includes */
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace AeroKernel::Bench
+{
+  /**
+   *  Summary of a single measurement. All latencies are in nanoseconds per operation
+   *  and include the cost of reading the clock.
+   */
+  struct Result
+  {
+    std::string name;    /**< Fully qualified measurement name, ie "read/INTERNAL_SRAM/64" */
+    size_t iterations;   /**< Number of timed operations */
+    size_t calls;        /**< Number of invocations, including the untimed warm up */
+    double minNs;        /**< Fastest observed operation */
+    double meanNs;       /**< Average over all operations */
+    double p50Ns;        /**< Median operation */
+    double p99Ns;        /**< 99th percentile operation */
+    double maxNs;        /**< Slowest observed operation */
+    double opsPerSec;    /**< Throughput derived from the mean */
+    size_t failures;     /**< Operations that reported failure */
+
+    std::vector<std::pair<std::string, double>> counters; /**< Benchmark specific extra values */
+  };
+
+  /**
+   *  Times each call of an operation exactly once, in order and with no warm up.
+   *  For operations that only make sense once per key, ie registration.
+   *
+   *  @param[in]  count     Number of calls to make
+   *  @param[in]  op        Operation to time. Receives the call index.
+   *  @return std::vector<uint64_t>   Latency of each call in nanoseconds
+   */
+  template<typename Operation>
+  std::vector<uint64_t> timeEach( const size_t count, Operation &&op )
+  {
+    using namespace std::chrono;
+
+    std::vector<uint64_t> samplesNs( count );
+
+    for ( size_t i = 0; i < count; i++ )
+    {
+      auto start = steady_clock::now();
+      op( i );
+      auto stop = steady_clock::now();
+
+      samplesNs[ i ] = static_cast<uint64_t>( duration_cast<nanoseconds>( stop - start ).count() );
+    }
+
+    return samplesNs;
+  }
+
+  /**
+   *  Handed to every benchmark. Collects the results of each measurement it makes.
+   *  References to recorded results stay valid for the whole run.
+   */
+  class Context
+  {
+  public:
+    Context( const size_t iterations, std::deque<Result> &results );
+
+    /**
+     *  Times an operation once per iteration after a short untimed warm up.
+     *
+     *  @param[in]  name        Name the result is reported under
+     *  @param[in]  iterations  How many times to run the operation
+     *  @param[in]  op          Operation to time. Receives the iteration index and
+     *                          returns false if the operation failed.
+     *  @return Result &        The recorded result, so counters can be attached
+     */
+    template<typename Operation>
+    Result &measure( const std::string &name, const size_t iterations, Operation &&op )
+    {
+      using namespace std::chrono;
+
+      size_t failures     = 0;
+      const size_t warmup = iterations / 10;
+      samples.resize( iterations );
+
+      for ( size_t i = 0; i < warmup; i++ )
+      {
+        op( i );
+      }
+
+      for ( size_t i = 0; i < iterations; i++ )
+      {
+        auto start = steady_clock::now();
+        bool ok    = op( i );
+        auto stop  = steady_clock::now();
+
+        samples[ i ] = static_cast<uint64_t>( duration_cast<nanoseconds>( stop - start ).count() );
+        failures += ok ? 0u : 1u;
+      }
+
+      return summarize( name, failures, iterations + warmup );
+    }
+
+    /**
+     *  Times an operation using the default iteration count
+     */
+    template<typename Operation>
+    Result &measure( const std::string &name, Operation &&op )
+    {
+      return measure( name, defaultIterations, std::forward<Operation>( op ) );
+    }
+
+    /**
+     *  Times each call of an operation exactly once with no warm up, see timeEach()
+     *
+     *  @param[in]  name        Name the result is reported under
+     *  @param[in]  count       Number of calls to make
+     *  @param[in]  op          Operation to time. Receives the call index and
+     *                          returns false if the operation failed.
+     *  @return Result &
+     */
+    template<typename Operation>
+    Result &measureOnce( const std::string &name, const size_t count, Operation &&op )
+    {
+      size_t failures = 0;
+      samples         = timeEach( count, [ & ]( const size_t i ) { failures += op( i ) ? 0u : 1u; } );
+
+      return summarize( name, failures, count );
+    }
+
+    /**
+     *  Records an externally timed set of samples, for benchmarks whose operations
+     *  cannot be wrapped in a single callable (ie one-shot phases).
+     *
+     *  @param[in]  name        Name the result is reported under
+     *  @param[in]  samplesNs   Per operation latencies in nanoseconds
+     *  @return Result &
+     */
+    Result &record( const std::string &name, const std::vector<uint64_t> &samplesNs );
+
+    /**
+     *  Records a result that only carries counters, ie a memory footprint. It has
+     *  no latency statistics and none are written out for it.
+     *
+     *  @param[in]  name        Name the result is reported under
+     *  @return Result &
+     */
+    Result &report( const std::string &name );
+
+    /**
+     *  Attaches an extra value to a result
+     */
+    static void counter( Result &result, const std::string &name, const double value );
+
+    /**
+     *  Number of iterations benchmarks should use when they have no reason to pick
+     *  their own. Controlled from the command line.
+     */
+    size_t iterations() const;
+
+  private:
+    Result &summarize( const std::string &name, const size_t failures, const size_t calls );
+
+    size_t defaultIterations;
+    std::vector<uint64_t> samples;
+    std::deque<Result> &results;
+  };
+
+  using BenchmarkFunc = std::function<void( Context & )>;
+
+  /**
+   *  Adds a benchmark to the suite. Normally invoked through AEROKERNEL_BENCHMARK.
+   *
+   *  @param[in]  name    Name used for filtering from the command line
+   *  @param[in]  func    The benchmark body
+   *  @return bool        Always true, so it can initialize a static
+   */
+  bool registerBenchmark( const std::string_view name, BenchmarkFunc func );
+
+  /**
+   *  Runs every registered benchmark whose name contains the filter string
+   *
+   *  @param[in]  filter      Substring to match against benchmark names. Empty runs all.
+   *  @param[in]  iterations  Default iteration count for each measurement
+   *  @return std::vector<Result>
+   */
+  std::vector<Result> runBenchmarks( const std::string_view filter, const size_t iterations );
+
+  /**
+   *  Writes results as a JSON document
+   *
+   *  @param[in]  stream      Where to write the document
+   *  @param[in]  results     The results to serialize
+   *  @return void
+   */
+  void writeJSON( std::ostream &stream, const std::vector<Result> &results );
+
+}  // namespace AeroKernel::Bench
+
+/**
+ *  Declares and registers a benchmark body. The body receives a Context named ctx.
+ */
+#define AEROKERNEL_BENCHMARK( name )                                                                                          \
+  static void name( ::AeroKernel::Bench::Context &ctx );                                                                     \
+  static const bool name##_registered = ::AeroKernel::Bench::registerBenchmark( #name, name );                              \
+  static void name( ::AeroKernel::Bench::Context &ctx )
+
+#endif /* !AEROKERNEL_BENCH_HARNESS_HPP */
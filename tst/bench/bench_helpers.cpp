@@ -0,0 +1,95 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_helpers.cpp
+ *
+ *  Description:
+ *    Parameter setup shared by the benchmarks
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <array>
+
+/* Benchmark Includes */
+#include "bench_helpers.hpp"
+
+namespace AeroKernel::Bench
+{
+  AeroKernel::Parameter::ControlBlock buildControlBlock( const size_t address, const size_t size,
+                                                         const AeroKernel::Parameter::StorageType storage )
+  {
+    AeroKernel::Parameter::ControlBlockFactory factory;
+    factory.setAddress( address );
+    factory.setSize( size );
+    factory.setStorage( storage );
+    factory.setUpdateCallback( nullptr );
+
+    return factory.build();
+  }
+
+  /*------------------------------------------------
+  Vocabulary for the synthetic names. The generator combines one entry
+  from each table.
+  ------------------------------------------------*/
+  static constexpr std::array<const char *, 12> Subsystems = {
+    "nav", "sensors", "motors", "power", "comms", "gimbal", "radio", "payload", "thermal", "log", "fence", "mission"
+  };
+
+  static constexpr std::array<const char *, 20> Components = {
+    "ekf", "imu", "baro", "mag", "gps", "esc", "pid", "batt", "bec", "link",
+    "camera", "servo", "fan", "heater", "sd", "zone", "wp", "rally", "rc", "flow"
+  };
+
+  static constexpr size_t ComponentInstances = 8;
+
+  static constexpr std::array<const char *, 10> Groups = {
+    "config", "state", "limits", "calib", "filter", "gains", "stats", "health", "timing", "offsets"
+  };
+
+  static constexpr std::array<const char *, 30> Fields = {
+    "bias", "scale", "offset", "gain", "kp", "ki", "kd", "rate", "min", "max",
+    "threshold", "timeout", "period", "cutoff_hz", "alpha", "variance", "error", "count", "enable", "mode",
+    "temp", "voltage", "current", "capacity", "gyro_bias", "accel_scale", "mag_decl", "baud", "priority", "retry_limit"
+  };
+
+  static constexpr std::array<const char *, 4> Axes = { "", "_x", "_y", "_z" };
+
+  static_assert( SyntheticNameSpace == Subsystems.size() * Components.size() * ComponentInstances * Groups.size()
+                                        * Fields.size() * Axes.size(),
+                 "SyntheticNameSpace must match the vocabulary" );
+
+  /*------------------------------------------------
+  Striding through the name space by a value coprime with its size visits
+  every combination exactly once, so names are unique while neighbouring
+  indices still look unrelated.
+  ------------------------------------------------*/
+  std::string syntheticName( const size_t index )
+  {
+    static constexpr size_t stride = 1000003;
+    static_assert( SyntheticNameSpace % stride != 0, "Stride must be coprime with the name space" );
+
+    size_t code = ( index * stride ) % SyntheticNameSpace;
+
+    const size_t axis = code % Axes.size();
+    code /= Axes.size();
+    const size_t field = code % Fields.size();
+    code /= Fields.size();
+    const size_t group = code % Groups.size();
+    code /= Groups.size();
+    const size_t instance = code % ComponentInstances;
+    code /= ComponentInstances;
+    const size_t component = code % Components.size();
+    code /= Components.size();
+    const size_t subsystem = code % Subsystems.size();
+
+    std::string name;
+    name.reserve( 48 );
+    name.append( Subsystems[ subsystem ] ).append( "/" );
+    name.append( Components[ component ] ).append( std::to_string( instance ) ).append( "/" );
+    name.append( Groups[ group ] ).append( "/" );
+    name.append( Fields[ field ] ).append( Axes[ axis ] );
+
+    return name;
+  }
+}  // namespace AeroKernel::Bench
@@ -0,0 +1,52 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_helpers.hpp
+ *
+ *  Description:
+ *    Parameter setup shared by the benchmarks
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef AEROKERNEL_BENCH_HELPERS_HPP
+#define AEROKERNEL_BENCH_HELPERS_HPP
+
+/* C++ Includes */
+#include <cstddef>
+#include <string>
+
+/* AeroKernel Includes */
+#include <AeroKernel/parameter.hpp>
+
+namespace AeroKernel::Bench
+{
+  /**
+   *  Builds a control block for a parameter with no update callback
+   *
+   *  @param[in]  address     Where the parameter lives on its device
+   *  @param[in]  size        Size of the parameter in bytes
+   *  @param[in]  storage     Which device holds it
+   *  @return AeroKernel::Parameter::ControlBlock
+   */
+  AeroKernel::Parameter::ControlBlock buildControlBlock( const size_t address, const size_t size,
+                                                         const AeroKernel::Parameter::StorageType storage );
+
+  /**
+   *  Number of unique names syntheticName() can build
+   */
+  static constexpr size_t SyntheticNameSpace = 2304000;
+
+  /**
+   *  Builds the i-th synthetic parameter name. Real keys are hierarchical, share
+   *  long prefixes within a subsystem and mostly end in a short field name, so
+   *  the names look like "nav/ekf3/state/gyro_bias_z".
+   *
+   *  @param[in]  index     Which name to build, less than SyntheticNameSpace
+   *  @return std::string
+   */
+  std::string syntheticName( const size_t index );
+
+}  // namespace AeroKernel::Bench
+
+#endif /* !AEROKERNEL_BENCH_HELPERS_HPP */
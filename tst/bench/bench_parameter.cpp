@@ -0,0 +1,168 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_parameter.cpp
+ *
+ *  Description:
+ *    Benchmarks for the Parameter Manager public API
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <array>
+#include <string>
+#include <vector>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+#include <fixtures/instrumented_device.hpp>
+#include <fixtures/virtual_memory_fixture.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+#include <AeroKernel/trace.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+using namespace Chimera::Modules::Memory;
+
+static constexpr std::array<size_t, 4> TransferSizes = { 1, 16, 256, 4096 };
+
+static std::vector<std::string> generateKeys( const std::string &prefix, const size_t count )
+{
+  std::vector<std::string> keys;
+  keys.reserve( count );
+
+  for ( size_t i = 0; i < count; i++ )
+  {
+    keys.push_back( prefix + std::to_string( i ) );
+  }
+
+  return keys;
+}
+
+static void addDriverCounters( Result &result, const InstrumentedDevice::OperationStats &stats )
+{
+  Context::counter( result, "driver_calls", static_cast<double>( stats.count ) );
+  Context::counter( result, "driver_bytes", static_cast<double>( stats.bytes ) );
+  Context::counter( result, "driver_errors", static_cast<double>( stats.errors ) );
+  Context::counter( result, "driver_ns_mean", stats.averageNs() );
+  Context::counter( result, "driver_ns_max", static_cast<double>( stats.maxNs ) );
+  Context::counter( result, "manager_overhead_ns", result.meanNs - stats.averageNs() );
+}
+
+/*------------------------------------------------
+Registration and lookup cost against the registry
+------------------------------------------------*/
+AEROKERNEL_BENCHMARK( ParameterRegistry )
+{
+  const size_t numKeys = ctx.iterations();
+  const auto hitKeys   = generateKeys( "param_", numKeys );
+  const auto missKeys  = generateKeys( "missing_", numKeys );
+  const auto cb        = buildControlBlock( 0, sizeof( uint32_t ), StorageType::INTERNAL_SRAM );
+
+  Manager mgr;
+  mgr.init( numKeys );
+
+  /*------------------------------------------------
+  Each key can only be registered once before it becomes an
+  overwrite, so time each registration once without a warm up.
+  ------------------------------------------------*/
+  ctx.measureOnce( "registration", numKeys, [ & ]( const size_t i ) {
+    AK_TRACE_ZONE( "Manager::registerParameter" );
+    return mgr.registerParameter( hitKeys[ i ], cb );
+  } );
+
+  ctx.measure( "registration/overwrite", [ & ]( const size_t i ) {
+    AK_TRACE_ZONE( "Manager::registerParameter" );
+    return mgr.registerParameter( hitKeys[ i % numKeys ], cb );
+  } );
+
+  ctx.measure( "lookup/hit", [ & ]( const size_t i ) {
+    AK_TRACE_ZONE( "Manager::isRegistered" );
+    return mgr.isRegistered( hitKeys[ i % numKeys ] );
+  } );
+
+  ctx.measure( "lookup/miss", [ & ]( const size_t i ) {
+    AK_TRACE_ZONE( "Manager::isRegistered" );
+    return !mgr.isRegistered( missKeys[ i % numKeys ] );
+  } );
+}
+
+/*------------------------------------------------
+Read/write throughput for each storage type backed by a VirtualMemoryDevice.
+The driver is wrapped so the time spent inside the driver can be separated
+from the time spent in the manager.
+------------------------------------------------*/
+AEROKERNEL_BENCHMARK( ParameterReadWrite )
+{
+  std::array<uint8_t, TransferSizes.back()> buffer;
+  buffer.fill( 0xA5 );
+
+  for ( const auto type : AllStorageTypes )
+  {
+    resetVirtualMemory();
+
+    auto driver = std::make_shared<InstrumentedDevice>( getVirtualMemoryDevice( type ) );
+
+    Manager mgr;
+    mgr.init( TransferSizes.size() );
+    mgr.registerMemoryDriver( type, driver );
+
+    for ( const auto size : TransferSizes )
+    {
+      const std::string suffix = std::string( getStorageName( type ) ) + "/" + std::to_string( size );
+      const std::string key    = "rw_" + suffix;
+
+      mgr.registerParameter( key, buildControlBlock( 0, size, type ) );
+
+      driver->resetStats();
+      auto &write = ctx.measure( "write/" + suffix, [ & ]( const size_t ) {
+        AK_TRACE_ZONE( "Manager::write" );
+        return mgr.write( key, buffer.data() );
+      } );
+      Context::counter( write, "bytes_per_sec", write.opsPerSec * size );
+      addDriverCounters( write, driver->getStats().write );
+
+      driver->resetStats();
+      auto &read = ctx.measure( "read/" + suffix, [ & ]( const size_t ) {
+        AK_TRACE_ZONE( "Manager::read" );
+        return mgr.read( key, buffer.data() );
+      } );
+      Context::counter( read, "bytes_per_sec", read.opsPerSec * size );
+      addDriverCounters( read, driver->getStats().read );
+    }
+  }
+}
+
+/*------------------------------------------------
+Cost of dispatching a registered update callback that writes the parameter
+------------------------------------------------*/
+AEROKERNEL_BENCHMARK( ParameterUpdate )
+{
+  resetVirtualMemory();
+
+  const std::string_view key = "update_target";
+  uint32_t value             = 0;
+
+  Manager mgr;
+  mgr.init( 1 );
+  mgr.registerMemoryDriver( StorageType::INTERNAL_SRAM, InternalSRAM_VMD );
+
+  ControlBlockFactory factory;
+  factory.setAddress( 0 );
+  factory.setSize( sizeof( value ) );
+  factory.setStorage( StorageType::INTERNAL_SRAM );
+  factory.setUpdateCallback( [ &mgr, &value ]( const std::string_view &k ) {
+    value++;
+    return mgr.write( k, &value );
+  } );
+
+  mgr.registerParameter( key, factory.build() );
+
+  ctx.measure( "update/callback", [ & ]( const size_t ) {
+    AK_TRACE_ZONE( "Manager::update" );
+    return mgr.update( key );
+  } );
+}
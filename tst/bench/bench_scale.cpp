@@ -0,0 +1,167 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_scale.cpp
+ *
+ *  Description:
+ *    Registry behaviour well past today's parameter counts. Builds registries of
+ *    10k to 1M synthetic keys named like real parameters and reports
+ *    registration time, rehash pauses and lookup throughput at each size.
+ *    Growing from the init() capacity the tests use is compared against a
+ *    presized table, reporting how many registrations blow a fixed latency
+ *    budget and the parameter count at each of the slowest calls.
+ *
+ *    The heap footprint at the same sizes is measured by ParameterScaleFootprint
+ *    in AeroKernelFootprint, away from these timings.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <algorithm>
+#include <array>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+static constexpr std::array<size_t, 3> ScaleSizes = { 10000, 100000, 1000000 };
+static_assert( ScaleSizes.back() <= SyntheticNameSpace, "Not enough unique synthetic names" );
+
+/**
+ *  Latency budgets a single registration is expected to stay under
+ */
+static constexpr std::array<std::pair<const char *, uint64_t>, 3> Budgets = {
+  { { "over_10us", 10000 }, { "over_100us", 100000 }, { "over_1ms", 1000000 } }
+};
+
+/**
+ *  How many of the slowest registrations to report the position of
+ */
+static constexpr size_t ReportedPauses = 5;
+
+/**
+ *  Registers every key, timing each call. Along with the latency summary this
+ *  reports how many calls went over each budget and the parameter count at
+ *  each of the slowest calls, which line up with the table's resize points.
+ *
+ *  @return Result &    The per registration latency
+ */
+static Result &registerAll( Context &ctx, const std::string &name, Manager &mgr, const std::vector<std::string> &keys,
+                            const ControlBlock &cb )
+{
+  const auto samples = timeEach( keys.size(), [ & ]( const size_t i ) { mgr.registerParameter( keys[ i ], cb ); } );
+
+  uint64_t totalNs = 0;
+  for ( const uint64_t ns : samples )
+  {
+    totalNs += ns;
+  }
+
+  auto &result = ctx.record( name, samples );
+  Context::counter( result, "total_ms", static_cast<double>( totalNs ) / 1.0e6 );
+
+  for ( const auto &budget : Budgets )
+  {
+    const auto over = std::count_if( samples.begin(), samples.end(), [ & ]( const uint64_t ns ) { return ns > budget.second; } );
+    Context::counter( result, budget.first, static_cast<double>( over ) );
+  }
+
+  /*------------------------------------------------
+  Positions of the slowest calls
+  ------------------------------------------------*/
+  std::vector<size_t> slowest( samples.size() );
+  for ( size_t i = 0; i < slowest.size(); i++ )
+  {
+    slowest[ i ] = i;
+  }
+
+  const size_t reported = std::min( ReportedPauses, slowest.size() );
+  std::partial_sort( slowest.begin(), slowest.begin() + reported, slowest.end(),
+                     [ & ]( const size_t a, const size_t b ) { return samples[ a ] > samples[ b ]; } );
+
+  for ( size_t x = 0; x < reported; x++ )
+  {
+    const std::string pause = "pause_" + std::to_string( x + 1 );
+    Context::counter( result, pause + "_at_count", static_cast<double>( slowest[ x ] + 1 ) );
+    Context::counter( result, pause + "_us", static_cast<double>( samples[ slowest[ x ] ] ) / 1000.0 );
+  }
+
+  return result;
+}
+
+AEROKERNEL_BENCHMARK( ParameterScale )
+{
+  const ControlBlock cb = buildControlBlock( 0, sizeof( uint32_t ), StorageType::INTERNAL_SRAM );
+
+  for ( const size_t size : ScaleSizes )
+  {
+    const std::string prefix = "scale/" + std::to_string( size );
+
+    std::vector<std::string> keys;
+    keys.reserve( size );
+
+    size_t nameBytes = 0;
+    for ( size_t i = 0; i < size; i++ )
+    {
+      keys.push_back( syntheticName( i ) );
+      nameBytes += keys.back().size();
+    }
+
+    /*------------------------------------------------
+    Sized the way the unit tests size it, so the table has to grow the
+    whole way up. The slowest calls are the rehash pauses.
+    ------------------------------------------------*/
+    Result *grown = nullptr;
+    {
+      Manager growing;
+      growing.init( 50 );
+
+      grown = &registerAll( ctx, prefix + "/register/init_50", growing, keys, cb );
+      Context::counter( *grown, "mean_key_length", static_cast<double>( nameBytes ) / size );
+    }
+
+    /*------------------------------------------------
+    Sized up front: no rehashing
+    ------------------------------------------------*/
+    Manager mgr;
+    mgr.init( size );
+
+    auto &presized = registerAll( ctx, prefix + "/register/presized", mgr, keys, cb );
+
+    Context::counter( *grown, "max_vs_presized", presized.maxNs ? ( grown->maxNs / presized.maxNs ) : 0.0 );
+    Context::counter( *grown, "p99_vs_presized", presized.p99Ns ? ( grown->p99Ns / presized.p99Ns ) : 0.0 );
+
+    /*------------------------------------------------
+    Lookups of every key in shuffled order, plus misses on names from
+    beyond the registered range, which share the same prefixes
+    ------------------------------------------------*/
+    std::vector<size_t> order( size );
+    for ( size_t i = 0; i < size; i++ )
+    {
+      order[ i ] = i;
+    }
+    std::shuffle( order.begin(), order.end(), std::mt19937( 0xAE50 ) );
+
+    ctx.measure( prefix + "/lookup/hit", size, [ & ]( const size_t i ) { return mgr.isRegistered( keys[ order[ i ] ] ); } );
+
+    const size_t missCount = std::min( size, SyntheticNameSpace - size );
+    std::vector<std::string> missing;
+    missing.reserve( missCount );
+    for ( size_t i = 0; i < missCount; i++ )
+    {
+      missing.push_back( syntheticName( size + i ) );
+    }
+
+    ctx.measure( prefix + "/lookup/miss", missCount, [ & ]( const size_t i ) { return !mgr.isRegistered( missing[ i ] ); } );
+  }
+}
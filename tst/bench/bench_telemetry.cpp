@@ -0,0 +1,111 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_telemetry.cpp
+ *
+ *  Description:
+ *    Cost of building a telemetry frame from 100 parameters, as the flight code
+ *    does at 1 kHz. Compares staging each value through a scratch buffer against
+ *    reading each value straight into its slot in the frame.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+#include <fixtures/instrumented_device.hpp>
+#include <fixtures/virtual_memory_fixture.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+static constexpr size_t TelemetryFields = 100;
+static constexpr double TelemetryRateHz = 1000.0;
+static constexpr size_t MaxFieldSize    = 16;
+
+struct TelemetryField
+{
+  std::string key;
+  size_t size;
+  size_t frameOffset;
+};
+
+static void addFrameCounters( Result &result, const InstrumentedDevice_sPtr &driver, const size_t frameSize )
+{
+  const auto stats = driver->getStats();
+
+  Context::counter( result, "frame_bytes", static_cast<double>( frameSize ) );
+  Context::counter( result, "driver_calls_per_frame", static_cast<double>( stats.read.count ) / result.calls );
+  Context::counter( result, "budget_used_pct", result.meanNs * TelemetryRateHz / 1.0e7 );
+  Context::counter( result, "p99_budget_used_pct", result.p99Ns * TelemetryRateHz / 1.0e7 );
+}
+
+AEROKERNEL_BENCHMARK( TelemetryFrame )
+{
+  resetVirtualMemory();
+
+  /*------------------------------------------------
+  A mix of field sizes typical of a state packet: flags, floats,
+  doubles, vectors and quaternions.
+  ------------------------------------------------*/
+  static constexpr std::array<size_t, 5> fieldSizes = { 1, 4, 8, 12, 16 };
+
+  auto driver = std::make_shared<InstrumentedDevice>( InternalSRAM_VMD );
+
+  Manager mgr;
+  mgr.init( TelemetryFields );
+  mgr.registerMemoryDriver( StorageType::INTERNAL_SRAM, driver );
+
+  std::vector<TelemetryField> fields;
+  size_t offset = 0;
+
+  for ( size_t i = 0; i < TelemetryFields; i++ )
+  {
+    TelemetryField field;
+    field.key         = "telemetry/field_" + std::to_string( i );
+    field.size        = fieldSizes[ i % fieldSizes.size() ];
+    field.frameOffset = offset;
+
+    mgr.registerParameter( field.key, buildControlBlock( offset, field.size, StorageType::INTERNAL_SRAM ) );
+
+    offset += field.size;
+    fields.push_back( field );
+  }
+
+  const size_t frameSize = offset;
+  std::vector<uint8_t> frame( frameSize );
+  std::array<uint8_t, MaxFieldSize> staging;
+
+  driver->resetStats();
+  auto &staged = ctx.measure( "telemetry/frame/staged", [ & ]( const size_t ) {
+    bool ok = true;
+    for ( const auto &field : fields )
+    {
+      ok &= mgr.read( field.key, staging.data() );
+      memcpy( frame.data() + field.frameOffset, staging.data(), field.size );
+    }
+    return ok;
+  } );
+  addFrameCounters( staged, driver, frameSize );
+
+  driver->resetStats();
+  auto &direct = ctx.measure( "telemetry/frame/direct", [ & ]( const size_t ) {
+    bool ok = true;
+    for ( const auto &field : fields )
+    {
+      ok &= mgr.read( field.key, frame.data() + field.frameOffset );
+    }
+    return ok;
+  } );
+  addFrameCounters( direct, driver, frameSize );
+}
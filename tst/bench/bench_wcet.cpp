@@ -0,0 +1,217 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_wcet.cpp
+ *
+ *  Description:
+ *    Worst case stress test of the Parameter Manager API. Every call is made
+ *    against a table filled to the capacity given to init() using key sets that
+ *    are hard on hashing and comparison, and the slowest call of each kind is
+ *    reported in time stamp counter ticks. Max values are the interesting output here; means are
+ *    reported only for context.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <utility>
+#include <string>
+#include <vector>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "timestamp_counter.hpp"
+#include <fixtures/virtual_memory_fixture.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+/**
+ *  Length of the shared part of the long keys. Longer than any real key so
+ *  hashing and string compares dominate.
+ */
+static constexpr size_t AdversarialPrefixLength = 256;
+
+/**
+ *  Most candidate keys hashed while searching for colliding ones, which keeps
+ *  the search to around a second
+ */
+static constexpr size_t CollisionSearchBudget = size_t( 1 ) << 26;
+
+struct KeySet
+{
+  const char *name;
+  std::vector<std::string> present;
+  std::vector<std::string> absent;
+};
+
+/**
+ *  Times every call in both TSC ticks and nanoseconds. Nanoseconds go into the
+ *  usual result fields; the tick distribution is attached as counters.
+ */
+static Result &measureWorstCase( Context &ctx, const std::string &name, const size_t calls,
+                                 const std::function<bool( const size_t )> &op )
+{
+  using namespace std::chrono;
+
+  std::vector<uint64_t> ns( calls );
+  std::vector<uint64_t> ticks( calls );
+  size_t failures = 0;
+
+  for ( size_t i = 0; i < calls; i++ )
+  {
+    auto start      = steady_clock::now();
+    uint64_t tStart = timestampStart();
+    bool ok         = op( i );
+    uint64_t tStop  = timestampStop();
+    auto stop       = steady_clock::now();
+
+    ns[ i ]    = static_cast<uint64_t>( duration_cast<nanoseconds>( stop - start ).count() );
+    ticks[ i ] = tStop - tStart;
+    failures += ok ? 0u : 1u;
+  }
+
+  std::sort( ticks.begin(), ticks.end() );
+
+  auto &result = ctx.record( name, ns );
+  Context::counter( result, HasTimestampCounter ? "max_tsc_ticks" : "max_ticks_ns", static_cast<double>( ticks.back() ) );
+  Context::counter( result, HasTimestampCounter ? "p999_tsc_ticks" : "p999_ticks_ns",
+                    static_cast<double>( ticks[ std::min( calls - 1, ( calls * 999 ) / 1000 ) ] ) );
+  Context::counter( result, "failed_calls", static_cast<double>( failures ) );
+
+  return result;
+}
+
+static KeySet buildKeySet( const char *name, const size_t count, const std::function<std::string( const size_t )> &generator )
+{
+  KeySet keys;
+  keys.name = name;
+  keys.present.reserve( count );
+  keys.absent.reserve( count );
+
+  for ( size_t i = 0; i < count; i++ )
+  {
+    keys.present.push_back( generator( 2 * i ) );
+    keys.absent.push_back( generator( ( 2 * i ) + 1 ) );
+  }
+
+  return keys;
+}
+
+/**
+ *  Finds keys whose hashes agree in their low bits. sparsepp hashes strings
+ *  with std::hash and picks a bucket from the low bits of the hash, so these
+ *  keys all start probing from the same bucket until the table outgrows the
+ *  matched bits, and even then share only a few buckets.
+ *
+ *  @param[in]  count     Number of keys to find
+ *  @param[in]  capacity  Capacity the table will be given
+ *  @param[out] bits      How many low bits every returned key shares
+ *  @return std::vector<std::string>
+ */
+static std::vector<std::string> collidingKeys( const size_t count, const size_t capacity, size_t &bits )
+{
+  /*------------------------------------------------
+  Match enough bits to cover every bucket of a table with this capacity,
+  unless finding that many keys would blow the search budget
+  ------------------------------------------------*/
+  bits = 1;
+  while ( ( ( size_t( 1 ) << bits ) < ( 4 * capacity ) ) && ( ( count << ( bits + 1 ) ) <= CollisionSearchBudget ) )
+  {
+    bits++;
+  }
+
+  const size_t mask = ( size_t( 1 ) << bits ) - 1;
+  const std::hash<std::string> hasher;
+
+  std::vector<std::string> keys;
+  keys.reserve( count );
+
+  for ( size_t candidate = 0; keys.size() < count; candidate++ )
+  {
+    std::string key = "collide/" + std::to_string( candidate );
+    if ( ( hasher( key ) & mask ) == 0 )
+    {
+      keys.push_back( std::move( key ) );
+    }
+  }
+
+  return keys;
+}
+
+static Result &stressKeySet( Context &ctx, const KeySet &keys )
+{
+  const size_t capacity = keys.present.size();
+  const std::string tag = std::string( "wcet/" ) + keys.name + "/";
+
+  resetVirtualMemory();
+
+  Manager mgr;
+  mgr.init( capacity );
+  mgr.registerMemoryDriver( StorageType::INTERNAL_SRAM, InternalSRAM_VMD );
+
+  ControlBlockFactory factory;
+  factory.setSize( sizeof( uint32_t ) );
+  factory.setStorage( StorageType::INTERNAL_SRAM );
+  factory.setUpdateCallback( [ &mgr ]( const std::string_view &key ) {
+    const uint32_t value = 0x5A5A5A5A;
+    return mgr.write( key, &value );
+  } );
+
+  auto addressOf = []( const size_t i ) { return ( i * sizeof( uint32_t ) ) % InternalSRAM_ByteSize; };
+
+  /*------------------------------------------------
+  Fill the table exactly to the capacity passed to init()
+  ------------------------------------------------*/
+  auto &fill = measureWorstCase( ctx, tag + "registerParameter/fill", capacity, [ & ]( const size_t i ) {
+    factory.setAddress( addressOf( i ) );
+    return mgr.registerParameter( keys.present[ i ], factory.build() );
+  } );
+
+  uint32_t value = 0;
+  measureWorstCase( ctx, tag + "isRegistered/hit", capacity, [ & ]( const size_t i ) { return mgr.isRegistered( keys.present[ i ] ); } );
+  measureWorstCase( ctx, tag + "isRegistered/miss", capacity, [ & ]( const size_t i ) { return !mgr.isRegistered( keys.absent[ i ] ); } );
+  measureWorstCase( ctx, tag + "read", capacity, [ & ]( const size_t i ) { return mgr.read( keys.present[ i ], &value ); } );
+  measureWorstCase( ctx, tag + "read/miss", capacity, [ & ]( const size_t i ) { return !mgr.read( keys.absent[ i ], &value ); } );
+  measureWorstCase( ctx, tag + "write", capacity, [ & ]( const size_t i ) { return mgr.write( keys.present[ i ], &value ); } );
+  measureWorstCase( ctx, tag + "update", capacity, [ & ]( const size_t i ) { return mgr.update( keys.present[ i ] ); } );
+
+  /*------------------------------------------------
+  Going past capacity forces the table to grow at least once
+  ------------------------------------------------*/
+  measureWorstCase( ctx, tag + "registerParameter/overflow", capacity, [ & ]( const size_t i ) {
+    factory.setAddress( addressOf( i ) );
+    return mgr.registerParameter( keys.absent[ i ], factory.build() );
+  } );
+
+  measureWorstCase( ctx, tag + "unregisterParameter", capacity, [ & ]( const size_t i ) { return mgr.unregisterParameter( keys.present[ i ] ); } );
+
+  return fill;
+}
+
+AEROKERNEL_BENCHMARK( ParameterWorstCase )
+{
+  const size_t count = ctx.iterations();
+  const std::string prefix( AdversarialPrefixLength, 'k' );
+
+  /* Short keys that differ only in their last characters */
+  stressKeySet( ctx, buildKeySet( "short_sequential", count, []( const size_t i ) { return std::to_string( i ); } ) );
+
+  /* Long keys that only differ after a long shared prefix, worst case for compares */
+  stressKeySet( ctx, buildKeySet( "long_shared_prefix", count, [ &prefix ]( const size_t i ) { return prefix + std::to_string( i ); } ) );
+
+  /* Long keys that only differ in their first characters */
+  stressKeySet( ctx, buildKeySet( "long_shared_suffix", count, [ &prefix ]( const size_t i ) { return std::to_string( i ) + prefix; } ) );
+
+  /* Keys that land in the same buckets, worst case for probing */
+  size_t bits         = 0;
+  const auto collided = collidingKeys( 2 * count, count, bits );
+
+  auto &fill = stressKeySet( ctx, buildKeySet( "low_bits_collide", count, [ &collided ]( const size_t i ) { return collided[ i ]; } ) );
+  Context::counter( fill, "colliding_low_bits", static_cast<double>( bits ) );
+}
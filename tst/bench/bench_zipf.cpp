@@ -0,0 +1,110 @@
+/********************************************************************************
+ *  File Name:
+ *    bench_zipf.cpp
+ *
+ *  Description:
+ *    Lookup and read latency under a Zipf distributed key workload, which is how
+ *    flight code actually hits the registry: a few keys (attitude gains, arming
+ *    flags) take almost all of the traffic.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include "bench_helpers.hpp"
+#include <fixtures/virtual_memory_fixture.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+using namespace AeroKernel::Bench;
+using namespace AeroKernel::Parameter;
+
+static constexpr size_t ZipfKeys = 1000;
+
+/**
+ *  Cache sizes worth considering for a small direct mapped front end
+ */
+static constexpr std::array<size_t, 3> ZipfCacheSizes = { 8, 16, 64 };
+
+/**
+ *  Pre-draws a sequence of key ranks (0 is the hottest) so sampling is not
+ *  part of the timed work.
+ */
+static std::vector<size_t> zipfSequence( const size_t keys, const double exponent, const size_t length )
+{
+  std::vector<double> cdf( keys );
+  double sum = 0.0;
+
+  for ( size_t rank = 0; rank < keys; rank++ )
+  {
+    sum += 1.0 / std::pow( static_cast<double>( rank + 1 ), exponent );
+    cdf[ rank ] = sum;
+  }
+
+  std::mt19937 rng( 0x21BF );
+  std::uniform_real_distribution<double> uniform( 0.0, sum );
+
+  std::vector<size_t> sequence( length );
+  for ( auto &rank : sequence )
+  {
+    rank = static_cast<size_t>( std::lower_bound( cdf.begin(), cdf.end(), uniform( rng ) ) - cdf.begin() );
+    rank = std::min( rank, keys - 1 );
+  }
+
+  return sequence;
+}
+
+AEROKERNEL_BENCHMARK( ParameterZipfLookup )
+{
+  resetVirtualMemory();
+
+  std::vector<std::string> keys;
+  for ( size_t i = 0; i < ZipfKeys; i++ )
+  {
+    keys.push_back( "flight/param_" + std::to_string( i ) );
+  }
+
+  Manager mgr;
+  mgr.init( ZipfKeys );
+  mgr.registerMemoryDriver( StorageType::INTERNAL_SRAM, InternalSRAM_VMD );
+
+  for ( size_t i = 0; i < ZipfKeys; i++ )
+  {
+    const size_t address = ( i * sizeof( uint32_t ) ) % InternalSRAM_ByteSize;
+    mgr.registerParameter( keys[ i ], buildControlBlock( address, sizeof( uint32_t ), StorageType::INTERNAL_SRAM ) );
+  }
+
+  for ( const double exponent : { 0.8, 1.0, 1.2 } )
+  {
+    const auto sequence = zipfSequence( ZipfKeys, exponent, ctx.iterations() );
+    const auto n        = sequence.size();
+    const auto suffix   = "/zipf_" + std::to_string( std::lround( exponent * 10 ) );
+
+    uint32_t value = 0;
+    auto &lookup   = ctx.measure( "lookup" + suffix, n, [ & ]( const size_t i ) { return mgr.isRegistered( keys[ sequence[ i ] ] ); } );
+    auto &read     = ctx.measure( "read" + suffix, n, [ & ]( const size_t i ) { return mgr.read( keys[ sequence[ i ] ], &value ); } );
+
+    /*------------------------------------------------
+    Share of traffic that lands on the N hottest keys: the best hit
+    rate an N entry cache could reach on this workload.
+    ------------------------------------------------*/
+    for ( const auto cacheSize : ZipfCacheSizes )
+    {
+      const auto hot = std::count_if( sequence.begin(), sequence.end(), [ cacheSize ]( const size_t rank ) { return rank < cacheSize; } );
+      const auto name = "top_" + std::to_string( cacheSize ) + "_share";
+
+      Context::counter( lookup, name, static_cast<double>( hot ) / n );
+      Context::counter( read, name, static_cast<double>( hot ) / n );
+    }
+  }
+}
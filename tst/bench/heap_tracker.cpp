@@ -0,0 +1,337 @@
+/********************************************************************************
+ *  File Name:
+ *    heap_tracker.cpp
+ *
+ *  Description:
+ *    Counts heap usage by interposing the C allocator. Containers that allocate
+ *    through malloc/realloc/free directly, such as sparsepp's default
+ *    libc_allocator, are seen as well as operator new. Every operator new and
+ *    delete form is also replaced so they all land on the same counted malloc
+ *    and free regardless of how the standard library routes them.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+/* Benchmark Includes */
+#include "heap_tracker.hpp"
+
+static std::atomic<int64_t> s_live_bytes( 0 );
+static std::atomic<int64_t> s_peak_bytes( 0 );
+static std::atomic<uint64_t> s_allocations( 0 );
+
+#if defined( __GLIBC__ )
+
+/* C Includes */
+#include <malloc.h>
+
+/*------------------------------------------------
+glibc exports its allocator under these names so a replacement malloc can
+forward to it. Sizes are taken from malloc_usable_size() on both the
+allocate and free side so the two always agree.
+------------------------------------------------*/
+extern "C" void *__libc_malloc( size_t size );
+extern "C" void *__libc_calloc( size_t count, size_t size );
+extern "C" void *__libc_realloc( void *ptr, size_t size );
+extern "C" void *__libc_memalign( size_t alignment, size_t size );
+extern "C" void *__libc_valloc( size_t size );
+extern "C" void *__libc_pvalloc( size_t size );
+extern "C" void __libc_free( void *ptr );
+
+static void *trackAllocation( void *ptr )
+{
+  if ( !ptr )
+  {
+    return ptr;
+  }
+
+  const auto size    = static_cast<int64_t>( malloc_usable_size( ptr ) );
+  const int64_t live = s_live_bytes.fetch_add( size, std::memory_order_relaxed ) + size;
+  s_allocations.fetch_add( 1, std::memory_order_relaxed );
+
+  int64_t peak = s_peak_bytes.load( std::memory_order_relaxed );
+  while ( ( live > peak ) && !s_peak_bytes.compare_exchange_weak( peak, live, std::memory_order_relaxed ) )
+  {
+  }
+
+  return ptr;
+}
+
+static void trackRelease( void *ptr )
+{
+  if ( ptr )
+  {
+    s_live_bytes.fetch_sub( static_cast<int64_t>( malloc_usable_size( ptr ) ), std::memory_order_relaxed );
+  }
+}
+
+extern "C"
+{
+  void *malloc( size_t size ) noexcept
+  {
+    return trackAllocation( __libc_malloc( size ) );
+  }
+
+  void *calloc( size_t count, size_t size ) noexcept
+  {
+    return trackAllocation( __libc_calloc( count, size ) );
+  }
+
+  void *realloc( void *ptr, size_t size ) noexcept
+  {
+    if ( !ptr )
+    {
+      return malloc( size );
+    }
+
+    /*------------------------------------------------
+    Release first: once realloc succeeds the old block may already be
+    gone. A failed realloc leaves it alive, so it is tracked again.
+    ------------------------------------------------*/
+    trackRelease( ptr );
+    void *result = __libc_realloc( ptr, size );
+
+    if ( result )
+    {
+      return trackAllocation( result );
+    }
+    else if ( size )
+    {
+      trackAllocation( ptr );
+    }
+
+    return result;
+  }
+
+  void *reallocarray( void *ptr, size_t count, size_t size ) noexcept
+  {
+    if ( size && ( count > ( SIZE_MAX / size ) ) )
+    {
+      errno = ENOMEM;
+      return nullptr;
+    }
+
+    return realloc( ptr, count * size );
+  }
+
+  void *memalign( size_t alignment, size_t size ) noexcept
+  {
+    return trackAllocation( __libc_memalign( alignment, size ) );
+  }
+
+  void *aligned_alloc( size_t alignment, size_t size ) noexcept
+  {
+    return memalign( alignment, size );
+  }
+
+  int posix_memalign( void **ptr, size_t alignment, size_t size ) noexcept
+  {
+    if ( ( alignment < sizeof( void * ) ) || ( alignment & ( alignment - 1 ) ) )
+    {
+      return EINVAL;
+    }
+
+    void *result = memalign( alignment, size );
+    if ( !result )
+    {
+      return ENOMEM;
+    }
+
+    *ptr = result;
+    return 0;
+  }
+
+  void *valloc( size_t size ) noexcept
+  {
+    return trackAllocation( __libc_valloc( size ) );
+  }
+
+  void *pvalloc( size_t size ) noexcept
+  {
+    return trackAllocation( __libc_pvalloc( size ) );
+  }
+
+  void free( void *ptr ) noexcept
+  {
+    trackRelease( ptr );
+    __libc_free( ptr );
+  }
+}
+
+#endif /* __GLIBC__ */
+
+/*------------------------------------------------
+Every operator new/delete form, so none of them can pair a block from one
+allocator with a release in another
+------------------------------------------------*/
+static void *allocate( size_t size )
+{
+  void *ptr = std::malloc( size ? size : 1 );
+  if ( !ptr )
+  {
+    throw std::bad_alloc();
+  }
+
+  return ptr;
+}
+
+static void *allocateAligned( size_t size, std::align_val_t alignment )
+{
+  const auto align = static_cast<size_t>( alignment );
+  void *ptr        = nullptr;
+
+  if ( posix_memalign( &ptr, ( align < sizeof( void * ) ) ? sizeof( void * ) : align, size ? size : 1 ) != 0 )
+  {
+    throw std::bad_alloc();
+  }
+
+  return ptr;
+}
+
+void *operator new( size_t size )
+{
+  return allocate( size );
+}
+
+void *operator new[]( size_t size )
+{
+  return allocate( size );
+}
+
+void *operator new( size_t size, const std::nothrow_t & ) noexcept
+{
+  return std::malloc( size ? size : 1 );
+}
+
+void *operator new[]( size_t size, const std::nothrow_t & ) noexcept
+{
+  return std::malloc( size ? size : 1 );
+}
+
+void *operator new( size_t size, std::align_val_t alignment )
+{
+  return allocateAligned( size, alignment );
+}
+
+void *operator new[]( size_t size, std::align_val_t alignment )
+{
+  return allocateAligned( size, alignment );
+}
+
+void *operator new( size_t size, std::align_val_t alignment, const std::nothrow_t & ) noexcept
+{
+  try
+  {
+    return allocateAligned( size, alignment );
+  }
+  catch ( ... )
+  {
+    return nullptr;
+  }
+}
+
+void *operator new[]( size_t size, std::align_val_t alignment, const std::nothrow_t & ) noexcept
+{
+  try
+  {
+    return allocateAligned( size, alignment );
+  }
+  catch ( ... )
+  {
+    return nullptr;
+  }
+}
+
+void operator delete( void *ptr ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void *ptr ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void *ptr, size_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void *ptr, size_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void *ptr, const std::nothrow_t & ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void *ptr, const std::nothrow_t & ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void *ptr, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void *ptr, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void *ptr, size_t, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void *ptr, size_t, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void *ptr, std::align_val_t, const std::nothrow_t & ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void *ptr, std::align_val_t, const std::nothrow_t & ) noexcept
+{
+  std::free( ptr );
+}
+
+namespace AeroKernel::Bench::Heap
+{
+  bool isAvailable()
+  {
+#if defined( __GLIBC__ )
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  Snapshot snapshot()
+  {
+    Snapshot snap;
+    snap.liveBytes   = s_live_bytes.load( std::memory_order_relaxed );
+    snap.peakBytes   = s_peak_bytes.load( std::memory_order_relaxed );
+    snap.allocations = s_allocations.load( std::memory_order_relaxed );
+
+    return snap;
+  }
+
+  void resetPeak()
+  {
+    s_peak_bytes.store( s_live_bytes.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+  }
+}  // namespace AeroKernel::Bench::Heap
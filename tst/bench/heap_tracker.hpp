@@ -0,0 +1,60 @@
+/********************************************************************************
+ *  File Name:
+ *    heap_tracker.hpp
+ *
+ *  Description:
+ *    Tracks every heap allocation made by the footprint executable so benchmarks
+ *    can report how much heap a registry actually consumes, including tables
+ *    that allocate through malloc directly.
+ *
+ *    Each allocation and free pays for a few atomic read-modify-writes, so this
+ *    is linked only into AeroKernelFootprint. Latency benchmarks live in
+ *    AeroKernelBench, which keeps the stock allocator.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef AEROKERNEL_BENCH_HEAP_TRACKER_HPP
+#define AEROKERNEL_BENCH_HEAP_TRACKER_HPP
+
+/* C++ Includes */
+#include <cstdint>
+
+namespace AeroKernel::Bench::Heap
+{
+  /**
+   *  Heap usage at a point in time
+   */
+  struct Snapshot
+  {
+    int64_t liveBytes;     /**< Usable bytes currently allocated, as malloc_usable_size() reports */
+    int64_t peakBytes;     /**< High water mark since the last resetPeak() */
+    uint64_t allocations;  /**< Total number of allocations ever made */
+  };
+
+  /**
+   *  Checks if allocations are being counted. Only glibc hosts support it; the
+   *  counters stay at zero everywhere else.
+   *
+   *  @return bool
+   */
+  bool isAvailable();
+
+  /**
+   *  Reads the current heap counters
+   *
+   *  @return Snapshot
+   */
+  Snapshot snapshot();
+
+  /**
+   *  Sets the high water mark back to the current live byte count
+   *
+   *  @return void
+   */
+  void resetPeak();
+
+}  // namespace AeroKernel::Bench::Heap
+
+#endif /* !AEROKERNEL_BENCH_HEAP_TRACKER_HPP */
@@ -0,0 +1,139 @@
+/********************************************************************************
+ *  File Name:
+ *    main.cpp
+ *
+ *  Description:
+ *    Entry point shared by the AeroKernelBench and AeroKernelFootprint executables
+ *
+ *    Usage: <executable> [--filter <substring>] [--iterations <count>] [--json <file>]
+ *                        [--trace <file>]
+ *
+ *    --trace writes a Chrome trace event file of every AK_TRACE_ZONE hit during
+ *    the run. Zones are only compiled in when AEROKERNEL_TRACE is defined.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+
+/* Benchmark Includes */
+#include "bench_harness.hpp"
+#include <fixtures/trace_recorder.hpp>
+
+/**
+ *  Enough for a default run of the suite with tracing enabled (~48 MB)
+ */
+static constexpr size_t MaxTraceRecords = 2 * 1024 * 1024;
+
+/**
+ *  Parses a positive decimal count
+ *
+ *  @param[in]  text      The argument to parse
+ *  @param[out] value     The parsed count, only written on success
+ *  @return bool          False if the text is not a whole number of at least 1
+ */
+static bool parseCount( const char *const text, size_t &value )
+{
+  if ( !text || ( *text < '0' ) || ( *text > '9' ) )
+  {
+    return false;
+  }
+
+  char *end = nullptr;
+  errno     = 0;
+
+  const auto parsed = std::strtoull( text, &end, 10 );
+
+  if ( ( errno != 0 ) || ( *end != '\0' ) || ( parsed < 1 ) || ( parsed > std::numeric_limits<size_t>::max() ) )
+  {
+    return false;
+  }
+
+  value = static_cast<size_t>( parsed );
+  return true;
+}
+
+int main( int argc, char **argv )
+{
+  std::string filter;
+  std::string jsonFile;
+  std::string traceFile;
+  size_t iterations = 10000;
+
+  for ( int i = 1; i < argc; i++ )
+  {
+    const std::string arg = argv[ i ];
+
+    if ( ( arg == "--filter" ) && ( ( i + 1 ) < argc ) )
+    {
+      filter = argv[ ++i ];
+    }
+    else if ( ( arg == "--iterations" ) && ( ( i + 1 ) < argc ) )
+    {
+      if ( !parseCount( argv[ ++i ], iterations ) )
+      {
+        std::cerr << "--iterations must be a whole number of at least 1" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    else if ( ( arg == "--json" ) && ( ( i + 1 ) < argc ) )
+    {
+      jsonFile = argv[ ++i ];
+    }
+    else if ( ( arg == "--trace" ) && ( ( i + 1 ) < argc ) )
+    {
+      traceFile = argv[ ++i ];
+    }
+    else
+    {
+      std::cerr << "Usage: " << argv[ 0 ] << " [--filter <substring>] [--iterations <count>] [--json <file>] [--trace <file>]"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  if ( !traceFile.empty() )
+  {
+#if !defined( AEROKERNEL_TRACE )
+    std::cerr << "Built without AEROKERNEL_TRACE; the trace will be empty" << std::endl;
+#endif
+    AeroKernel::Trace::initialize( MaxTraceRecords );
+  }
+
+  auto results = AeroKernel::Bench::runBenchmarks( filter, iterations );
+
+  if ( !traceFile.empty() )
+  {
+    std::ofstream trace( traceFile );
+    AeroKernel::Trace::writeChromeTrace( trace );
+
+    if ( AeroKernel::Trace::dropped() )
+    {
+      std::cerr << "Trace buffer full, dropped " << AeroKernel::Trace::dropped() << " zones" << std::endl;
+    }
+  }
+
+  if ( jsonFile.empty() )
+  {
+    AeroKernel::Bench::writeJSON( std::cout, results );
+  }
+  else
+  {
+    std::ofstream file( jsonFile );
+    if ( !file )
+    {
+      std::cerr << "Unable to open " << jsonFile << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    AeroKernel::Bench::writeJSON( file, results );
+  }
+
+  return EXIT_SUCCESS;
+}
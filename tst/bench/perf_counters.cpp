@@ -0,0 +1,139 @@
+/********************************************************************************
+ *  File Name:
+ *    perf_counters.cpp
+ *
+ *  Description:
+ *    Reads CPU cache counters around a block of benchmark code
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* Benchmark Includes */
+#include "perf_counters.hpp"
+
+#if defined( __linux__ )
+
+/* Linux Includes */
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static int openCounter( const uint64_t config, const int groupFd )
+{
+  perf_event_attr attr;
+  memset( &attr, 0, sizeof( attr ) );
+
+  attr.type           = PERF_TYPE_HARDWARE;
+  attr.size           = sizeof( attr );
+  attr.config         = config;
+  attr.disabled       = ( groupFd < 0 ) ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+
+  return static_cast<int>( syscall( __NR_perf_event_open, &attr, 0, -1, groupFd, 0 ) );
+}
+
+static uint64_t readCounter( const int fd )
+{
+  uint64_t value = 0;
+  if ( ( fd < 0 ) || ( read( fd, &value, sizeof( value ) ) != sizeof( value ) ) )
+  {
+    return 0;
+  }
+
+  return value;
+}
+
+namespace AeroKernel::Bench
+{
+  CacheCounters::CacheCounters()
+  {
+    referenceFd = openCounter( PERF_COUNT_HW_CACHE_REFERENCES, -1 );
+    missFd      = ( referenceFd < 0 ) ? -1 : openCounter( PERF_COUNT_HW_CACHE_MISSES, referenceFd );
+  }
+
+  CacheCounters::~CacheCounters()
+  {
+    if ( missFd >= 0 )
+    {
+      close( missFd );
+    }
+
+    if ( referenceFd >= 0 )
+    {
+      close( referenceFd );
+    }
+  }
+
+  bool CacheCounters::isAvailable() const
+  {
+    return ( referenceFd >= 0 ) && ( missFd >= 0 );
+  }
+
+  void CacheCounters::start()
+  {
+    if ( isAvailable() )
+    {
+      ioctl( referenceFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+      ioctl( referenceFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+    }
+  }
+
+  void CacheCounters::stop()
+  {
+    if ( isAvailable() )
+    {
+      ioctl( referenceFd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+    }
+  }
+
+  uint64_t CacheCounters::references() const
+  {
+    return readCounter( referenceFd );
+  }
+
+  uint64_t CacheCounters::misses() const
+  {
+    return readCounter( missFd );
+  }
+}  // namespace AeroKernel::Bench
+
+#else
+
+namespace AeroKernel::Bench
+{
+  CacheCounters::CacheCounters() : referenceFd( -1 ), missFd( -1 )
+  {
+  }
+
+  CacheCounters::~CacheCounters()
+  {
+  }
+
+  bool CacheCounters::isAvailable() const
+  {
+    return false;
+  }
+
+  void CacheCounters::start()
+  {
+  }
+
+  void CacheCounters::stop()
+  {
+  }
+
+  uint64_t CacheCounters::references() const
+  {
+    return 0;
+  }
+
+  uint64_t CacheCounters::misses() const
+  {
+    return 0;
+  }
+}  // namespace AeroKernel::Bench
+
+#endif /* __linux__ */
@@ -0,0 +1,58 @@
+/********************************************************************************
+ *  File Name:
+ *    perf_counters.hpp
+ *
+ *  Description:
+ *    Reads CPU cache counters around a block of benchmark code. Uses the Linux
+ *    perf_event interface; on other hosts, or where the kernel forbids access
+ *    (see /proc/sys/kernel/perf_event_paranoid), the counters are unavailable
+ *    and benchmarks simply omit them.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef AEROKERNEL_BENCH_PERF_COUNTERS_HPP
+#define AEROKERNEL_BENCH_PERF_COUNTERS_HPP
+
+/* C++ Includes */
+#include <cstdint>
+
+namespace AeroKernel::Bench
+{
+  class CacheCounters
+  {
+  public:
+    CacheCounters();
+    ~CacheCounters();
+
+    CacheCounters( const CacheCounters & ) = delete;
+    CacheCounters &operator=( const CacheCounters & ) = delete;
+
+    /**
+     *  Checks if the host allowed the counters to be opened
+     *
+     *  @return bool
+     */
+    bool isAvailable() const;
+
+    /**
+     *  Zeroes and enables the counters
+     */
+    void start();
+
+    /**
+     *  Disables the counters, leaving their values readable
+     */
+    void stop();
+
+    uint64_t references() const;
+    uint64_t misses() const;
+
+  private:
+    int referenceFd;
+    int missFd;
+  };
+}  // namespace AeroKernel::Bench
+
+#endif /* !AEROKERNEL_BENCH_PERF_COUNTERS_HPP */
@@ -0,0 +1,73 @@
+/********************************************************************************
+ *  File Name:
+ *    timestamp_counter.hpp
+ *
+ *  Description:
+ *    Cheapest available per-call timestamp for worst case measurements. Uses the
+ *    x86 time stamp counter where present, otherwise falls back to nanoseconds
+ *    from the steady clock. TSC ticks run at a fixed rate on modern parts, so
+ *    they are not core cycles and do not follow frequency scaling.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef AEROKERNEL_BENCH_TIMESTAMP_COUNTER_HPP
+#define AEROKERNEL_BENCH_TIMESTAMP_COUNTER_HPP
+
+/* C++ Includes */
+#include <chrono>
+#include <cstdint>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <x86intrin.h>
+#endif
+
+namespace AeroKernel::Bench
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+  static constexpr bool HasTimestampCounter = true;
+
+  /**
+   *  Reads the TSC at the start of a timed region. The lfence keeps the read
+   *  from executing before the instructions ahead of it have finished.
+   *
+   *  @return uint64_t
+   */
+  static inline uint64_t timestampStart()
+  {
+    _mm_lfence();
+    return __rdtsc();
+  }
+
+  /**
+   *  Reads the TSC at the end of a timed region. rdtscp waits for the timed
+   *  code to finish and the lfence keeps later instructions from starting
+   *  before the read.
+   *
+   *  @return uint64_t
+   */
+  static inline uint64_t timestampStop()
+  {
+    unsigned int processor = 0;
+    const uint64_t ticks   = __rdtscp( &processor );
+    _mm_lfence();
+    return ticks;
+  }
+#else
+  static constexpr bool HasTimestampCounter = false;
+
+  static inline uint64_t timestampStart()
+  {
+    using namespace std::chrono;
+    return static_cast<uint64_t>( duration_cast<nanoseconds>( steady_clock::now().time_since_epoch() ).count() );
+  }
+
+  static inline uint64_t timestampStop()
+  {
+    return timestampStart();
+  }
+#endif
+}  // namespace AeroKernel::Bench
+
+#endif /* !AEROKERNEL_BENCH_TIMESTAMP_COUNTER_HPP */
@@ -0,0 +1,430 @@
+/********************************************************************************
+ *  File Name:
+ *    change_stream.cpp
+ *
+ *  Description:
+ *    Shared memory ring for streaming parameter changes to a local client
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#if !defined( _WIN32 )
+
+/* C++ Includes */
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+/* POSIX Includes */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Test Fixture Includes */
+#include <fixtures/change_stream.hpp>
+
+using namespace Chimera::CommonStatusCodes;
+
+namespace ChangeStream
+{
+  static constexpr uint32_t Magic = 0x414B4353; /* "AKCS" */
+  static constexpr size_t CacheLine = 64;
+
+  /*------------------------------------------------
+  The indices are shared between processes, so they must never fall back
+  to a lock hidden inside the process that created them
+  ------------------------------------------------*/
+  static_assert( std::atomic<uint64_t>::is_always_lock_free, "Ring indices must be lock free" );
+  static_assert( std::atomic<uint32_t>::is_always_lock_free, "Ring generation must be lock free" );
+
+  /*------------------------------------------------
+  A writer reopening an existing ring resets it in place under a sequence
+  count: generation is odd while the header is being rewritten and moves
+  on by two for every reset. The indices never go backwards across a reset,
+  so a tail update left over from before it can never match.
+  ------------------------------------------------*/
+  struct SharedHeader
+  {
+    uint32_t magic;
+    uint32_t recordSize;
+    uint64_t capacity;
+    alignas( CacheLine ) std::atomic<uint32_t> generation;
+    alignas( CacheLine ) std::atomic<uint64_t> head; /**< Written by the producer only */
+    alignas( CacheLine ) std::atomic<uint64_t> tail; /**< Written by the consumer only */
+    alignas( CacheLine ) std::atomic<uint64_t> dropped;
+  };
+
+  static constexpr size_t RecordOffset = ( ( sizeof( SharedHeader ) + CacheLine - 1 ) / CacheLine ) * CacheLine;
+
+  static uint64_t steadyNowNs()
+  {
+    using namespace std::chrono;
+    return static_cast<uint64_t>( duration_cast<nanoseconds>( steady_clock::now().time_since_epoch() ).count() );
+  }
+
+  /*------------------------------------------------
+  Writer
+  ------------------------------------------------*/
+  Writer::Writer() :
+      fileDescriptor( -1 ), mappedSize( 0 ), shared( nullptr ), ring( nullptr ), policy( Backpressure::DROP_NEWEST ),
+      pendingHead( 0 ), nextSequence( 0 ), batchSize( 0 )
+  {
+  }
+
+  Writer::~Writer()
+  {
+    close();
+  }
+
+  bool Writer::open( const std::string &path, const size_t capacity, const Backpressure policy )
+  {
+    if ( shared || !capacity )
+    {
+      return false;
+    }
+
+    const size_t size = RecordOffset + ( capacity * sizeof( Record ) );
+
+    /*------------------------------------------------
+    Truncating a file a reader has mapped would fault the reader on its
+    next access, so an existing file is only ever grown
+    ------------------------------------------------*/
+    fileDescriptor = ::open( path.c_str(), O_RDWR | O_CREAT, 0644 );
+    if ( fileDescriptor < 0 )
+    {
+      return false;
+    }
+
+    struct stat fileInfo;
+    if ( ( fstat( fileDescriptor, &fileInfo ) != 0 )
+         || ( ( static_cast<size_t>( fileInfo.st_size ) < size ) && ( ftruncate( fileDescriptor, size ) != 0 ) ) )
+    {
+      ::close( fileDescriptor );
+      fileDescriptor = -1;
+      return false;
+    }
+
+    void *mapping = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0 );
+    if ( mapping == MAP_FAILED )
+    {
+      ::close( fileDescriptor );
+      fileDescriptor = -1;
+      return false;
+    }
+
+    mappedSize   = size;
+    shared       = static_cast<SharedHeader *>( mapping );
+    ring         = reinterpret_cast<Record *>( static_cast<uint8_t *>( mapping ) + RecordOffset );
+    this->policy = policy;
+    nextSequence = 0;
+
+    /*------------------------------------------------
+    A new file is zero filled. An existing ring restarts just past the
+    furthest index either side reached, so the indices keep increasing.
+    ------------------------------------------------*/
+    uint64_t base = 0;
+    if ( shared->magic == Magic )
+    {
+      base = std::max( shared->head.load( std::memory_order_acquire ), shared->tail.load( std::memory_order_acquire ) ) + 1;
+    }
+
+    pendingHead = base;
+
+    /*------------------------------------------------
+    Rewrite the header inside an odd generation so a reader never uses a
+    half reset one. The magic goes in last for readers attaching to a new
+    file, which check it before anything else.
+    ------------------------------------------------*/
+    shared->generation.fetch_add( 1, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_release );
+
+    shared->recordSize = sizeof( Record );
+    shared->capacity   = capacity;
+    shared->head.store( base, std::memory_order_relaxed );
+    shared->tail.store( base, std::memory_order_relaxed );
+    shared->dropped.store( 0, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_release );
+    shared->magic = Magic;
+
+    shared->generation.fetch_add( 1, std::memory_order_release );
+
+    return true;
+  }
+
+  void Writer::close()
+  {
+    if ( !shared )
+    {
+      return;
+    }
+
+    munmap( shared, mappedSize );
+    ::close( fileDescriptor );
+
+    shared         = nullptr;
+    ring           = nullptr;
+    mappedSize     = 0;
+    fileDescriptor = -1;
+  }
+
+  bool Writer::push( const uint32_t channel, const uint32_t address, const uint8_t *const data, const size_t length )
+  {
+    if ( !shared || !data )
+    {
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock( producerLock );
+
+    const uint64_t timestamp = steadyNowNs();
+    const size_t needed      = ( length + MaxInlineBytes - 1 ) / MaxInlineBytes;
+
+    /*------------------------------------------------
+    Reserve room for the whole change up front so a client can never
+    receive part of a value. Dropped records still consume sequence
+    numbers, which is how the client sees the loss.
+    ------------------------------------------------*/
+    if ( !waitForSpace( needed ) )
+    {
+      shared->dropped.fetch_add( needed, std::memory_order_relaxed );
+      nextSequence += needed;
+      return false;
+    }
+
+    /*------------------------------------------------
+    Split long values into inline sized records at consecutive addresses
+    ------------------------------------------------*/
+    for ( size_t offset = 0; offset < length; offset += MaxInlineBytes )
+    {
+      const size_t chunk = std::min( length - offset, MaxInlineBytes );
+      Record &record     = ring[ pendingHead % shared->capacity ];
+
+      record.sequence    = nextSequence++;
+      record.timestampNs = timestamp;
+      record.channel     = channel;
+      record.address     = static_cast<uint32_t>( address + offset );
+      record.length      = static_cast<uint32_t>( chunk );
+      record.reserved    = 0;
+      memcpy( record.data, data + offset, chunk );
+
+      pendingHead++;
+    }
+
+    if ( batchSize && ( ( pendingHead - shared->head.load( std::memory_order_relaxed ) ) >= batchSize ) )
+    {
+      shared->head.store( pendingHead, std::memory_order_release );
+    }
+
+    return true;
+  }
+
+  void Writer::publish()
+  {
+    if ( shared )
+    {
+      std::lock_guard<std::mutex> lock( producerLock );
+      shared->head.store( pendingHead, std::memory_order_release );
+    }
+  }
+
+  void Writer::setBatchSize( const size_t records )
+  {
+    std::lock_guard<std::mutex> lock( producerLock );
+    batchSize = records;
+  }
+
+  uint64_t Writer::dropped() const
+  {
+    return shared ? shared->dropped.load( std::memory_order_relaxed ) : 0;
+  }
+
+  bool Writer::waitForSpace( const size_t records )
+  {
+    const uint64_t capacity = shared->capacity;
+
+    if ( records > capacity )
+    {
+      return false;
+    }
+    else if ( ( capacity - ( pendingHead - shared->tail.load( std::memory_order_acquire ) ) ) >= records )
+    {
+      return true;
+    }
+    else if ( policy == Backpressure::DROP_NEWEST )
+    {
+      return false;
+    }
+
+    /*------------------------------------------------
+    Blocking: anything pushed but not yet published has to become visible
+    first, otherwise a reader waiting on it could never free a slot.
+    ------------------------------------------------*/
+    shared->head.store( pendingHead, std::memory_order_release );
+
+    while ( ( capacity - ( pendingHead - shared->tail.load( std::memory_order_acquire ) ) ) < records )
+    {
+      std::this_thread::yield();
+    }
+
+    return true;
+  }
+
+  /*------------------------------------------------
+  Reader
+  ------------------------------------------------*/
+  Reader::Reader() : fileDescriptor( -1 ), mappedSize( 0 ), shared( nullptr ), ring( nullptr )
+  {
+  }
+
+  Reader::~Reader()
+  {
+    close();
+  }
+
+  bool Reader::open( const std::string &path )
+  {
+    if ( shared )
+    {
+      return false;
+    }
+
+    fileDescriptor = ::open( path.c_str(), O_RDWR );
+    if ( fileDescriptor < 0 )
+    {
+      return false;
+    }
+
+    struct stat fileInfo;
+    if ( ( fstat( fileDescriptor, &fileInfo ) != 0 ) || ( static_cast<size_t>( fileInfo.st_size ) < RecordOffset ) )
+    {
+      ::close( fileDescriptor );
+      fileDescriptor = -1;
+      return false;
+    }
+
+    const size_t size = static_cast<size_t>( fileInfo.st_size );
+    void *mapping     = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0 );
+    if ( mapping == MAP_FAILED )
+    {
+      ::close( fileDescriptor );
+      fileDescriptor = -1;
+      return false;
+    }
+
+    auto header = static_cast<SharedHeader *>( mapping );
+    std::atomic_thread_fence( std::memory_order_acquire );
+
+    const uint32_t generation = ( header->magic == Magic ) ? header->generation.load( std::memory_order_acquire ) : 1;
+    const size_t ringSize     = RecordOffset + ( header->capacity * sizeof( Record ) );
+    const uint32_t recordSize = header->recordSize;
+    std::atomic_thread_fence( std::memory_order_acquire );
+
+    if ( ( generation & 1 ) || ( header->generation.load( std::memory_order_relaxed ) != generation )
+         || ( recordSize != sizeof( Record ) ) || ( ringSize > size ) )
+    {
+      munmap( mapping, size );
+      ::close( fileDescriptor );
+      fileDescriptor = -1;
+      return false;
+    }
+
+    mappedSize = size;
+    shared     = header;
+    ring       = reinterpret_cast<const Record *>( static_cast<uint8_t *>( mapping ) + RecordOffset );
+
+    return true;
+  }
+
+  void Reader::close()
+  {
+    if ( !shared )
+    {
+      return;
+    }
+
+    munmap( shared, mappedSize );
+    ::close( fileDescriptor );
+
+    shared         = nullptr;
+    ring           = nullptr;
+    mappedSize     = 0;
+    fileDescriptor = -1;
+  }
+
+  size_t Reader::poll( Record *const records, const size_t maxRecords )
+  {
+    if ( !shared || !records )
+    {
+      return 0;
+    }
+
+    /*------------------------------------------------
+    Follow the writer across a reset, as long as the ring still fits in
+    what this reader mapped
+    ------------------------------------------------*/
+    const uint32_t generation = shared->generation.load( std::memory_order_acquire );
+    const uint64_t capacity   = shared->capacity;
+
+    if ( ( generation & 1 ) || !capacity || ( ( RecordOffset + ( capacity * sizeof( Record ) ) ) > mappedSize ) )
+    {
+      return 0;
+    }
+
+    uint64_t tail       = shared->tail.load( std::memory_order_acquire );
+    const uint64_t head = shared->head.load( std::memory_order_acquire );
+    const size_t count  = ( head > tail ) ? static_cast<size_t>( std::min<uint64_t>( head - tail, maxRecords ) ) : 0;
+
+    for ( size_t x = 0; x < count; x++ )
+    {
+      records[ x ] = ring[ ( tail + x ) % capacity ];
+    }
+
+    /*------------------------------------------------
+    Anything copied while a reset was underway is stale. The tail only
+    moves if it has not been reset since it was read.
+    ------------------------------------------------*/
+    std::atomic_thread_fence( std::memory_order_acquire );
+    if ( shared->generation.load( std::memory_order_relaxed ) != generation )
+    {
+      return 0;
+    }
+
+    if ( count && !shared->tail.compare_exchange_strong( tail, tail + count, std::memory_order_release ) )
+    {
+      return 0;
+    }
+
+    return count;
+  }
+
+  uint64_t Reader::dropped() const
+  {
+    return shared ? shared->dropped.load( std::memory_order_relaxed ) : 0;
+  }
+}  // namespace ChangeStream
+
+/*------------------------------------------------
+ChangeStreamDevice
+------------------------------------------------*/
+ChangeStreamDevice::ChangeStreamDevice( Chimera::Modules::Memory::Device_sPtr device,
+                                        std::shared_ptr<ChangeStream::Writer> writer, const uint32_t channel ) :
+    DeviceDecorator( device ),
+    writer( writer ), channel( channel )
+{
+}
+
+Chimera::Status_t ChangeStreamDevice::write( const size_t address, const uint8_t *const data, const size_t length )
+{
+  auto result = DeviceDecorator::write( address, data, length );
+
+  if ( ( result == OK ) && writer )
+  {
+    writer->push( channel, static_cast<uint32_t>( address ), data, length );
+  }
+
+  return result;
+}
+
+#endif /* !_WIN32 */
@@ -0,0 +1,211 @@
+/********************************************************************************
+ *  File Name:
+ *    change_stream.hpp
+ *
+ *  Description:
+ *    Streams parameter changes out of a host simulation to a local client (ie a
+ *    ground station bridge) through a shared memory ring, instead of the client
+ *    polling parameters one at a time. The ring lives in a memory mapped file;
+ *    put it under /dev/shm to keep it in RAM. POSIX hosts only.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef CHANGE_STREAM_HPP
+#define CHANGE_STREAM_HPP
+
+#if !defined( _WIN32 )
+
+/* C++ Includes */
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/* Test Fixture Includes */
+#include <fixtures/device_decorator.hpp>
+
+namespace ChangeStream
+{
+  /**
+   *  Largest value carried by one record. Longer writes are split into several
+   *  records at consecutive addresses.
+   */
+  static constexpr size_t MaxInlineBytes = 48;
+
+  /**
+   *  One change, as seen by the client
+   */
+  struct Record
+  {
+    uint64_t sequence;                /**< Increments by one per record, dropped ones included, so a gap means loss */
+    uint64_t timestampNs;             /**< Steady clock time the change was made */
+    uint32_t channel;                 /**< Which device/storage type was written */
+    uint32_t address;                 /**< Device address of data[0] */
+    uint32_t length;                  /**< Valid bytes in data */
+    uint32_t reserved;
+    uint8_t data[ MaxInlineBytes ];   /**< The new value */
+  };
+
+  /**
+   *  What the writer does when the client has fallen behind and the ring is full
+   */
+  enum class Backpressure : uint8_t
+  {
+    DROP_NEWEST, /**< Discard the new record and count it; never blocks the flight code */
+    BLOCK        /**< Wait for the client to make room */
+  };
+
+  /**
+   *  Control block at the start of the ring file. Defined in the source file.
+   */
+  struct SharedHeader;
+
+  /**
+   *  Producer side of the ring. Thread safe; pushes from several devices are
+   *  serialized internally.
+   */
+  class Writer
+  {
+  public:
+    Writer();
+    ~Writer();
+
+    /**
+     *  Creates the ring file, or resets one left by an earlier writer, and maps
+     *  it. An existing file is never shrunk, so a reader still mapping it stays
+     *  safe; it sees the reset and carries on with the new ring.
+     *
+     *  @param[in]  path        File to hold the ring
+     *  @param[in]  capacity    Number of records the ring can hold
+     *  @param[in]  policy      How to behave when the ring is full
+     *  @return bool
+     */
+    bool open( const std::string &path, const size_t capacity, const Backpressure policy );
+    void close();
+
+    /**
+     *  Appends a change. Nothing is visible to the client until publish().
+     *
+     *  A change split over several records is delivered whole or not at all;
+     *  under DROP_NEWEST it is dropped unless every record fits. A change that
+     *  needs more records than the ring holds is always dropped. Dropped records
+     *  still use up sequence numbers.
+     *
+     *  @return bool    False if the change was dropped
+     */
+    bool push( const uint32_t channel, const uint32_t address, const uint8_t *const data, const size_t length );
+
+    /**
+     *  Makes every pushed record visible to the client in one step. Call it at
+     *  the end of each batch of changes, ie once per simulation tick.
+     */
+    void publish();
+
+    /**
+     *  Publishes automatically from push() once this many records are pending,
+     *  which bounds how far the client can fall behind between flushes. Zero,
+     *  the default, leaves publishing entirely to publish().
+     *
+     *  @param[in]  records     Pending records that trigger a publish
+     */
+    void setBatchSize( const size_t records );
+
+    uint64_t dropped() const;
+
+  private:
+    /**
+     *  Makes sure the ring has room for this many records, waiting for the
+     *  client if the policy allows it
+     *
+     *  @param[in]  records     Number of free slots required
+     *  @return bool            False if the records must be dropped
+     */
+    bool waitForSpace( const size_t records );
+
+    int fileDescriptor;
+    size_t mappedSize;
+    SharedHeader *shared;
+    Record *ring;
+    Backpressure policy;
+
+    std::mutex producerLock;
+    uint64_t pendingHead;
+    uint64_t nextSequence;
+    size_t batchSize;
+  };
+
+  /**
+   *  Consumer side of the ring. Only one reader may be attached at a time.
+   */
+  class Reader
+  {
+  public:
+    Reader();
+    ~Reader();
+
+    /**
+     *  Maps a ring file created by a Writer
+     *
+     *  @param[in]  path    File that holds the ring
+     *  @return bool
+     */
+    bool open( const std::string &path );
+    void close();
+
+    /**
+     *  Copies out up to maxRecords published records, oldest first. Returns
+     *  nothing while the writer is resetting the ring. Once it has, sequence
+     *  numbers start again from zero. If the writer reopened with a ring larger
+     *  than this reader mapped, this keeps returning nothing and the reader
+     *  must be reopened.
+     *
+     *  @param[out] records     Destination for the records
+     *  @param[in]  maxRecords  Space available at records
+     *  @return size_t          Number of records copied
+     */
+    size_t poll( Record *const records, const size_t maxRecords );
+
+    /**
+     *  Gets how many records the writer has discarded so far
+     */
+    uint64_t dropped() const;
+
+  private:
+    int fileDescriptor;
+    size_t mappedSize;
+    SharedHeader *shared;
+    const Record *ring;
+  };
+}  // namespace ChangeStream
+
+/**
+ *  Device wrapper that pushes every successful write through a ChangeStream::Writer.
+ *  Writes are only pushed; the owner of the writer publishes them in batches,
+ *  either by calling publish() at its flush points or through setBatchSize().
+ *  Erases are not streamed; the parameter layer changes values only through
+ *  writes.
+ */
+class ChangeStreamDevice : public DeviceDecorator
+{
+public:
+  /**
+   *  @param[in]  device    Device to wrap
+   *  @param[in]  writer    Stream to publish to; may be shared between devices
+   *  @param[in]  channel   Identifies this device in the records
+   */
+  ChangeStreamDevice( Chimera::Modules::Memory::Device_sPtr device, std::shared_ptr<ChangeStream::Writer> writer,
+                      const uint32_t channel );
+  ~ChangeStreamDevice() = default;
+
+  Chimera::Status_t write( const size_t address, const uint8_t *const data, const size_t length ) override;
+
+private:
+  std::shared_ptr<ChangeStream::Writer> writer;
+  const uint32_t channel;
+};
+
+#endif /* !_WIN32 */
+#endif /* !CHANGE_STREAM_HPP */
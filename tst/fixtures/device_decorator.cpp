@@ -0,0 +1,57 @@
+/********************************************************************************
+ *  File Name:
+ *    device_decorator.cpp
+ *
+ *  Description:
+ *    Base class for memory devices that wrap another device and forward to it.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#include <fixtures/device_decorator.hpp>
+
+using namespace Chimera::Modules::Memory;
+
+DeviceDecorator::DeviceDecorator( Device_sPtr device ) : device( device )
+{
+}
+
+Chimera::Status_t DeviceDecorator::write( const size_t address, const uint8_t *const data, const size_t length )
+{
+  return device->write( address, data, length );
+}
+
+Chimera::Status_t DeviceDecorator::read( const size_t address, uint8_t *const data, const size_t length )
+{
+  return device->read( address, data, length );
+}
+
+Chimera::Status_t DeviceDecorator::erase( const size_t address, const size_t length )
+{
+  return device->erase( address, length );
+}
+
+Chimera::Status_t DeviceDecorator::writeCompleteCallback( const Chimera::void_func_uint32_t func )
+{
+  return device->writeCompleteCallback( func );
+}
+
+Chimera::Status_t DeviceDecorator::readCompleteCallback( const Chimera::void_func_uint32_t func )
+{
+  return device->readCompleteCallback( func );
+}
+
+Chimera::Status_t DeviceDecorator::eraseCompleteCallback( const Chimera::void_func_uint32_t func )
+{
+  return device->eraseCompleteCallback( func );
+}
+
+bool DeviceDecorator::isInitialized()
+{
+  return device->isInitialized();
+}
+
+Device_sPtr DeviceDecorator::getWrappedDevice()
+{
+  return device;
+}
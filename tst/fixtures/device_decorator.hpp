@@ -0,0 +1,47 @@
+/********************************************************************************
+ *  File Name:
+ *    device_decorator.hpp
+ *
+ *  Description:
+ *    Base class for memory devices that wrap another device and forward to it.
+ *    Derived classes override only the calls they want to observe or alter.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef DEVICE_DECORATOR_HPP
+#define DEVICE_DECORATOR_HPP
+
+/* Chimera Includes */
+#include <Chimera/modules/memory/device.hpp>
+
+class DeviceDecorator : public Chimera::Modules::Memory::Device
+{
+public:
+  /**
+   *  @param[in]  device    The device that all calls are forwarded to
+   */
+  DeviceDecorator( Chimera::Modules::Memory::Device_sPtr device );
+  virtual ~DeviceDecorator() = default;
+
+  Chimera::Status_t write( const size_t address, const uint8_t *const data, const size_t length ) override;
+  Chimera::Status_t read( const size_t address, uint8_t *const data, const size_t length ) override;
+  Chimera::Status_t erase( const size_t address, const size_t length ) override;
+  Chimera::Status_t writeCompleteCallback( const Chimera::void_func_uint32_t func ) override;
+  Chimera::Status_t readCompleteCallback( const Chimera::void_func_uint32_t func ) override;
+  Chimera::Status_t eraseCompleteCallback( const Chimera::void_func_uint32_t func ) override;
+  bool isInitialized() override;
+
+  /**
+   *  Gets the device that is being wrapped
+   *
+   *  @return Chimera::Modules::Memory::Device_sPtr
+   */
+  Chimera::Modules::Memory::Device_sPtr getWrappedDevice();
+
+protected:
+  Chimera::Modules::Memory::Device_sPtr device;
+};
+
+#endif /* !DEVICE_DECORATOR_HPP */
@@ -0,0 +1,228 @@
+/********************************************************************************
+ *  File Name:
+ *    fault_injecting_device.cpp
+ *
+ *  Description:
+ *    Seeded fault and latency injection around a memory device
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/* Test Fixture Includes */
+#include <fixtures/fault_injecting_device.hpp>
+
+using namespace Chimera::CommonStatusCodes;
+using namespace Chimera::Modules::Memory;
+
+/**
+ *  Maps a raw engine output onto [0, 1) using its top 53 bits, which is
+ *  every bit a double can hold
+ *
+ *  @param[in]  draw      Output of the 64 bit engine
+ *  @return double
+ */
+static inline double chance( const uint64_t draw )
+{
+  return static_cast<double>( draw >> 11 ) * ( 1.0 / 9007199254740992.0 );
+}
+
+FaultInjectingDevice::FaultInjectingDevice( Device_sPtr device, const Faults &faults ) : DeviceDecorator( device )
+{
+  setFaults( faults );
+  resetCounts();
+}
+
+FaultInjectingDevice::FaultInjectingDevice( Device_sPtr device ) : FaultInjectingDevice( device, Faults() )
+{
+}
+
+Chimera::Status_t FaultInjectingDevice::write( const size_t address, const uint8_t *const data, const size_t length )
+{
+  Plan plan = draw( length, Operation::WRITE );
+
+  delay( plan );
+
+  if ( plan.fail )
+  {
+    failedWrites.fetch_add( 1, std::memory_order_relaxed );
+    return FAIL;
+  }
+  else if ( plan.partial )
+  {
+    partialTransfers.fetch_add( 1, std::memory_order_relaxed );
+
+    auto result = plan.partialLength ? device->write( address, data, plan.partialLength ) : OK;
+    return ( ( result != OK ) || plan.reportPartial ) ? FAIL : OK;
+  }
+  else if ( plan.flip && data )
+  {
+    /*------------------------------------------------
+    Corrupt a copy so the caller's buffer is never modified
+    ------------------------------------------------*/
+    std::vector<uint8_t> corrupted( data, data + length );
+    corrupted[ plan.flipBit / 8 ] ^= static_cast<uint8_t>( 1u << ( plan.flipBit % 8 ) );
+    bitFlips.fetch_add( 1, std::memory_order_relaxed );
+
+    return device->write( address, corrupted.data(), length );
+  }
+
+  return device->write( address, data, length );
+}
+
+Chimera::Status_t FaultInjectingDevice::read( const size_t address, uint8_t *const data, const size_t length )
+{
+  Plan plan = draw( length, Operation::READ );
+
+  delay( plan );
+
+  if ( plan.partial )
+  {
+    /*------------------------------------------------
+    The tail of the caller's buffer is left holding whatever it had before
+    ------------------------------------------------*/
+    partialTransfers.fetch_add( 1, std::memory_order_relaxed );
+
+    auto result = plan.partialLength ? device->read( address, data, plan.partialLength ) : OK;
+    return ( ( result != OK ) || plan.reportPartial ) ? FAIL : OK;
+  }
+
+  auto result = device->read( address, data, length );
+
+  if ( ( result == OK ) && plan.flip && data )
+  {
+    data[ plan.flipBit / 8 ] ^= static_cast<uint8_t>( 1u << ( plan.flipBit % 8 ) );
+    bitFlips.fetch_add( 1, std::memory_order_relaxed );
+  }
+
+  return result;
+}
+
+Chimera::Status_t FaultInjectingDevice::erase( const size_t address, const size_t length )
+{
+  Plan plan = draw( 0, Operation::ERASE );
+  delay( plan );
+
+  return device->erase( address, length );
+}
+
+void FaultInjectingDevice::setFaults( const Faults &faults )
+{
+  std::lock_guard<std::mutex> lock( rngLock );
+
+  this->faults = faults;
+  rng.seed( faults.seed );
+}
+
+FaultInjectingDevice::Faults FaultInjectingDevice::getFaults() const
+{
+  std::lock_guard<std::mutex> lock( rngLock );
+  return faults;
+}
+
+FaultInjectingDevice::InjectedCounts FaultInjectingDevice::getInjectedCounts() const
+{
+  InjectedCounts counts;
+
+  counts.calls            = calls.load( std::memory_order_relaxed );
+  counts.delayNs          = delayNs.load( std::memory_order_relaxed );
+  counts.stalls           = stalls.load( std::memory_order_relaxed );
+  counts.bitFlips         = bitFlips.load( std::memory_order_relaxed );
+  counts.failedWrites     = failedWrites.load( std::memory_order_relaxed );
+  counts.partialTransfers = partialTransfers.load( std::memory_order_relaxed );
+
+  return counts;
+}
+
+void FaultInjectingDevice::resetCounts()
+{
+  calls.store( 0, std::memory_order_relaxed );
+  delayNs.store( 0, std::memory_order_relaxed );
+  stalls.store( 0, std::memory_order_relaxed );
+  bitFlips.store( 0, std::memory_order_relaxed );
+  failedWrites.store( 0, std::memory_order_relaxed );
+  partialTransfers.store( 0, std::memory_order_relaxed );
+}
+
+FaultInjectingDevice::Plan FaultInjectingDevice::draw( const size_t length, const Operation operation )
+{
+  std::lock_guard<std::mutex> lock( rngLock );
+
+  Plan plan = {};
+
+  double flipProbability = 0.0;
+  double failProbability = 0.0;
+
+  if ( operation == Operation::READ )
+  {
+    flipProbability = faults.readBitFlipProbability;
+  }
+  else if ( operation == Operation::WRITE )
+  {
+    flipProbability = faults.writeBitFlipProbability;
+    failProbability = faults.writeFailureProbability;
+  }
+
+  /*------------------------------------------------
+  Every decision is drawn on every call, even when its probability is
+  zero, so changing one probability does not shift the others' sequence.
+  Values are derived straight from the engine, whose output the standard
+  fixes, rather than through the std distributions, whose output it does
+  not, so a seed replays the same faults on any standard library.
+  ------------------------------------------------*/
+  const uint64_t jitter = rng() % ( static_cast<uint64_t>( faults.latencyJitterNs ) + 1 );
+  const bool stall      = chance( rng() ) < faults.stallProbability;
+  const bool fail       = chance( rng() ) < failProbability;
+  const bool partial    = chance( rng() ) < faults.partialTransferProbability;
+  const bool flip       = chance( rng() ) < flipProbability;
+  const uint64_t cut    = rng() % ( length ? length : 1 );
+  const uint64_t bit    = rng() % ( length ? ( length * 8 ) : 1 );
+
+  plan.delayNs       = faults.latencyNs + jitter + ( stall ? faults.stallNs : 0 );
+  plan.fail          = fail;
+  plan.partial       = partial && ( length > 0 );
+  plan.flip          = flip && ( length > 0 );
+  plan.partialLength = static_cast<size_t>( cut );
+  plan.flipBit       = static_cast<size_t>( bit );
+  plan.reportPartial = faults.reportPartialTransfers;
+
+  calls.fetch_add( 1, std::memory_order_relaxed );
+  if ( stall )
+  {
+    stalls.fetch_add( 1, std::memory_order_relaxed );
+  }
+
+  return plan;
+}
+
+void FaultInjectingDevice::delay( const Plan &plan )
+{
+  /*------------------------------------------------
+  Short delays spin since they are below the scheduler's sleep granularity.
+  Long stalls sleep so they don't starve other threads on small hosts.
+  ------------------------------------------------*/
+  static constexpr uint64_t sleepThresholdNs = 100000;
+
+  if ( !plan.delayNs )
+  {
+    return;
+  }
+
+  using namespace std::chrono;
+  delayNs.fetch_add( plan.delayNs, std::memory_order_relaxed );
+
+  if ( plan.delayNs >= sleepThresholdNs )
+  {
+    std::this_thread::sleep_for( nanoseconds( plan.delayNs ) );
+    return;
+  }
+
+  const auto deadline = steady_clock::now() + nanoseconds( plan.delayNs );
+  while ( steady_clock::now() < deadline )
+  {
+  }
+}
@@ -0,0 +1,135 @@
+/********************************************************************************
+ *  File Name:
+ *    fault_injecting_device.hpp
+ *
+ *  Description:
+ *    Memory device wrapper that makes a healthy device misbehave: extra latency,
+ *    occasional long stalls, bit flips, failed writes and partial transfers. All
+ *    decisions come from a seeded RNG so a run can be repeated exactly.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef FAULT_INJECTING_DEVICE_HPP
+#define FAULT_INJECTING_DEVICE_HPP
+
+/* C++ Includes */
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+
+/* Test Fixture Includes */
+#include <fixtures/device_decorator.hpp>
+
+class FaultInjectingDevice : public DeviceDecorator
+{
+public:
+  /**
+   *  What to inject. Probabilities are per call and range from 0.0 to 1.0.
+   *  The defaults inject nothing.
+   */
+  struct Faults
+  {
+    uint64_t seed                     = 0;     /**< RNG seed; the same seed replays the same faults */
+    uint32_t latencyNs                = 0;     /**< Added to every call */
+    uint32_t latencyJitterNs          = 0;     /**< Up to this much more, uniformly distributed */
+    double stallProbability           = 0.0;   /**< Chance a call also takes stallNs */
+    uint32_t stallNs                  = 0;     /**< Length of a stall, ie a flash busy period */
+    double readBitFlipProbability     = 0.0;   /**< Chance one bit of the returned data is flipped */
+    double writeBitFlipProbability    = 0.0;   /**< Chance one bit of the stored data is flipped */
+    double writeFailureProbability    = 0.0;   /**< Chance a write is rejected without touching the device */
+    double partialTransferProbability = 0.0;   /**< Chance only a prefix of a read/write is transferred */
+    bool reportPartialTransfers       = true;  /**< Partial transfers return FAIL, else they silently return OK */
+  };
+
+  /**
+   *  Faults injected since construction or the last resetCounts()
+   */
+  struct InjectedCounts
+  {
+    uint64_t calls;            /**< Read, write and erase calls seen */
+    uint64_t delayNs;          /**< Total latency added, stalls included */
+    uint64_t stalls;
+    uint64_t bitFlips;
+    uint64_t failedWrites;
+    uint64_t partialTransfers;
+  };
+
+  /**
+   *  @param[in]  device    Device to wrap
+   *  @param[in]  faults    What to inject
+   */
+  FaultInjectingDevice( Chimera::Modules::Memory::Device_sPtr device, const Faults &faults );
+
+  /**
+   *  Wraps the device without injecting anything until setFaults() is called
+   *
+   *  @param[in]  device    Device to wrap
+   */
+  FaultInjectingDevice( Chimera::Modules::Memory::Device_sPtr device );
+  ~FaultInjectingDevice() = default;
+
+  Chimera::Status_t write( const size_t address, const uint8_t *const data, const size_t length ) override;
+  Chimera::Status_t read( const size_t address, uint8_t *const data, const size_t length ) override;
+
+  /**
+   *  Erases only see latency and stalls
+   */
+  Chimera::Status_t erase( const size_t address, const size_t length ) override;
+
+  /**
+   *  Replaces the fault configuration and reseeds the RNG from it
+   *
+   *  @param[in]  faults    What to inject
+   *  @return void
+   */
+  void setFaults( const Faults &faults );
+  Faults getFaults() const;
+
+  InjectedCounts getInjectedCounts() const;
+  void resetCounts();
+
+private:
+  enum class Operation : uint8_t
+  {
+    READ,
+    WRITE,
+    ERASE
+  };
+
+  /**
+   *  Everything that will happen to one call, drawn up front under the RNG
+   *  lock so the delay and the I/O itself run without holding it.
+   */
+  struct Plan
+  {
+    uint64_t delayNs;
+    bool fail;
+    bool partial;
+    size_t partialLength;
+    bool flip;
+    size_t flipBit;
+    bool reportPartial;
+  };
+
+  Plan draw( const size_t length, const Operation operation );
+  void delay( const Plan &plan );
+
+  mutable std::mutex rngLock;
+  Faults faults;
+  std::mt19937_64 rng;
+
+  std::atomic<uint64_t> calls;
+  std::atomic<uint64_t> delayNs;
+  std::atomic<uint64_t> stalls;
+  std::atomic<uint64_t> bitFlips;
+  std::atomic<uint64_t> failedWrites;
+  std::atomic<uint64_t> partialTransfers;
+};
+
+using FaultInjectingDevice_sPtr = std::shared_ptr<FaultInjectingDevice>;
+
+#endif /* !FAULT_INJECTING_DEVICE_HPP */
@@ -0,0 +1,141 @@
+/********************************************************************************
+ *  File Name:
+ *    fram_device_model.cpp
+ *
+ *  Description:
+ *    Host side timing model of an SPI F-RAM such as the MB85RS64V
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <chrono>
+
+/* Test Fixture Includes */
+#include <fixtures/fram_device_model.hpp>
+
+using namespace Chimera::Modules::Memory;
+
+FRAMDeviceModel::FRAMDeviceModel( Device_sPtr device, const Timing &timing ) : DeviceDecorator( device ), timing( timing )
+{
+  /*------------------------------------------------
+  Every transaction time divides by the clock
+  ------------------------------------------------*/
+  if ( !this->timing.clockFrequency )
+  {
+    this->timing.clockFrequency = DefaultClockFrequency;
+  }
+
+  resetCounters();
+}
+
+FRAMDeviceModel::FRAMDeviceModel( Device_sPtr device ) : FRAMDeviceModel( device, Timing() )
+{
+}
+
+Chimera::Status_t FRAMDeviceModel::write( const size_t address, const uint8_t *const data, const size_t length )
+{
+  std::lock_guard<std::mutex> lock( bus );
+
+  auto result = device->write( address, data, length );
+  chargeAccess( result, length, true );
+
+  return result;
+}
+
+Chimera::Status_t FRAMDeviceModel::read( const size_t address, uint8_t *const data, const size_t length )
+{
+  std::lock_guard<std::mutex> lock( bus );
+
+  auto result = device->read( address, data, length );
+  chargeAccess( result, length, false );
+
+  return result;
+}
+
+Chimera::Status_t FRAMDeviceModel::erase( const size_t address, const size_t length )
+{
+  std::lock_guard<std::mutex> lock( bus );
+
+  auto result = device->erase( address, length );
+  chargeAccess( result, length, true );
+
+  return result;
+}
+
+uint64_t FRAMDeviceModel::transactionTimeNs( const size_t bytes ) const
+{
+  const uint64_t bits = static_cast<uint64_t>( bytes ) * 8u;
+  return timing.transactionNs + ( ( bits * 1000000000ull ) / timing.clockFrequency );
+}
+
+FRAMDeviceModel::BusStats FRAMDeviceModel::getBusStats() const
+{
+  BusStats stats;
+  stats.transactions = transactions.load( std::memory_order_relaxed );
+  stats.busBytes     = busBytes.load( std::memory_order_relaxed );
+  stats.payloadBytes = payloadBytes.load( std::memory_order_relaxed );
+  stats.busTimeNs    = busTimeNs.load( std::memory_order_relaxed );
+  stats.failed       = failed.load( std::memory_order_relaxed );
+
+  return stats;
+}
+
+void FRAMDeviceModel::resetCounters()
+{
+  transactions.store( 0, std::memory_order_relaxed );
+  busBytes.store( 0, std::memory_order_relaxed );
+  payloadBytes.store( 0, std::memory_order_relaxed );
+  busTimeNs.store( 0, std::memory_order_relaxed );
+  failed.store( 0, std::memory_order_relaxed );
+}
+
+void FRAMDeviceModel::chargeAccess( const Chimera::Status_t result, const size_t payload, const bool isWrite )
+{
+  if ( result != Chimera::CommonStatusCodes::OK )
+  {
+    failed.fetch_add( 1, std::memory_order_relaxed );
+    return;
+  }
+
+  uint64_t elapsed  = 0;
+  uint64_t cycles   = 1;
+  const size_t size = timing.opcodeBytes + timing.addressBytes + payload;
+
+  /*------------------------------------------------
+  The write enable latch is cleared after every write, so the
+  driver has to send WREN in its own chip select cycle each time.
+  ------------------------------------------------*/
+  if ( isWrite && timing.writeEnablePerWrite )
+  {
+    elapsed += transactionTimeNs( timing.opcodeBytes );
+    busBytes.fetch_add( timing.opcodeBytes, std::memory_order_relaxed );
+    cycles++;
+  }
+
+  elapsed += transactionTimeNs( size );
+
+  transactions.fetch_add( cycles, std::memory_order_relaxed );
+  busBytes.fetch_add( size, std::memory_order_relaxed );
+  payloadBytes.fetch_add( payload, std::memory_order_relaxed );
+  busTimeNs.fetch_add( elapsed, std::memory_order_relaxed );
+
+  if ( timing.realTime )
+  {
+    busyWait( elapsed );
+  }
+}
+
+void FRAMDeviceModel::busyWait( const uint64_t ns ) const
+{
+  /*------------------------------------------------
+  Transactions are only a few microseconds long, which is well below
+  the scheduler's sleep granularity, so spin on the clock instead.
+  ------------------------------------------------*/
+  using namespace std::chrono;
+  const auto deadline = steady_clock::now() + nanoseconds( ns );
+
+  while ( steady_clock::now() < deadline )
+  {
+  }
+}
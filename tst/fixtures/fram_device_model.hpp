@@ -0,0 +1,122 @@
+/********************************************************************************
+ *  File Name:
+ *    fram_device_model.hpp
+ *
+ *  Description:
+ *    Host side timing model of an SPI F-RAM such as the MB85RS64V. Data is held
+ *    in a wrapped device (normally a VirtualMemoryDevice) while every transaction
+ *    is charged the time it would take on the SPI bus, so throughput changes can
+ *    be measured without the Nucleo board.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef FRAM_DEVICE_MODEL_HPP
+#define FRAM_DEVICE_MODEL_HPP
+
+/* C++ Includes */
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+/* Test Fixture Includes */
+#include <fixtures/device_decorator.hpp>
+
+class FRAMDeviceModel : public DeviceDecorator
+{
+public:
+  /**
+   *  SPI clock of the MB85RS64V integration test, which runs SPI3 at 8 MHz
+   */
+  static constexpr uint32_t DefaultClockFrequency = 8000000;
+
+  /**
+   *  Bus and protocol parameters. Defaults match the MB85RS64V integration test.
+   */
+  struct Timing
+  {
+    uint32_t clockFrequency  = DefaultClockFrequency; /**< SPI clock in Hz; zero selects the default */
+    size_t opcodeBytes       = 1;                     /**< Command byte(s) sent before each access */
+    size_t addressBytes      = 2;                     /**< Address width; 2 bytes for the 8 KB part */
+    uint32_t transactionNs   = 0;                     /**< Fixed cost per chip select cycle (setup, hold, driver) */
+    bool writeEnablePerWrite = true;                  /**< Each write is preceded by its own WREN transaction */
+    bool realTime            = false;                 /**< Busy wait for the modelled time instead of only counting it */
+  };
+
+  /**
+   *  Bus activity since construction or the last resetCounters()
+   */
+  struct BusStats
+  {
+    uint64_t transactions; /**< Chip select cycles, including WREN */
+    uint64_t busBytes;     /**< Bytes clocked, including opcode and address overhead */
+    uint64_t payloadBytes; /**< Bytes of user data moved */
+    uint64_t busTimeNs;    /**< Total modelled bus time */
+    uint64_t failed;       /**< Accesses the wrapped device rejected; these are not charged */
+
+    /**
+     *  Payload throughput achieved over the modelled bus time, in bytes/s
+     */
+    double effectiveThroughput() const
+    {
+      return busTimeNs ? ( static_cast<double>( payloadBytes ) * 1.0e9 / busTimeNs ) : 0.0;
+    }
+  };
+
+  /**
+   *  @param[in]  device    Device that holds the F-RAM contents
+   *  @param[in]  timing    Bus parameters to model
+   */
+  FRAMDeviceModel( Chimera::Modules::Memory::Device_sPtr device, const Timing &timing );
+
+  /**
+   *  Models the MB85RS64V at the default Timing
+   *
+   *  @param[in]  device    Device that holds the F-RAM contents
+   */
+  FRAMDeviceModel( Chimera::Modules::Memory::Device_sPtr device );
+  ~FRAMDeviceModel() = default;
+
+  Chimera::Status_t write( const size_t address, const uint8_t *const data, const size_t length ) override;
+  Chimera::Status_t read( const size_t address, uint8_t *const data, const size_t length ) override;
+
+  /**
+   *  F-RAM has no erase cycle, so an erase is charged as a write of the same length
+   */
+  Chimera::Status_t erase( const size_t address, const size_t length ) override;
+
+  /**
+   *  Calculates the modelled time of a single chip select cycle
+   *
+   *  @param[in]  bytes     Total bytes clocked in the transaction
+   *  @return uint64_t      Nanoseconds
+   */
+  uint64_t transactionTimeNs( const size_t bytes ) const;
+
+  BusStats getBusStats() const;
+  void resetCounters();
+
+private:
+  /**
+   *  Charges one successful access (plus WREN if needed) against the bus. Called
+   *  with the bus lock held so concurrent callers queue the way they would on
+   *  real hardware. Rejected accesses never reach the bus and are only counted.
+   */
+  void chargeAccess( const Chimera::Status_t result, const size_t payload, const bool isWrite );
+  void busyWait( const uint64_t ns ) const;
+
+  Timing timing;
+  std::mutex bus;
+
+  std::atomic<uint64_t> transactions;
+  std::atomic<uint64_t> busBytes;
+  std::atomic<uint64_t> payloadBytes;
+  std::atomic<uint64_t> busTimeNs;
+  std::atomic<uint64_t> failed;
+};
+
+using FRAMDeviceModel_sPtr = std::shared_ptr<FRAMDeviceModel>;
+
+#endif /* !FRAM_DEVICE_MODEL_HPP */
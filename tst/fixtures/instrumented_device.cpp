@@ -0,0 +1,121 @@
+/********************************************************************************
+ *  File Name:
+ *    instrumented_device.cpp
+ *
+ *  Description:
+ *    Memory device wrapper that counts every operation issued to a driver
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <chrono>
+
+/* AeroKernel Includes */
+#include <AeroKernel/trace.hpp>
+
+/* Test Fixture Includes */
+#include <fixtures/instrumented_device.hpp>
+
+using namespace Chimera::Modules::Memory;
+
+static inline uint64_t elapsedSince( const std::chrono::steady_clock::time_point &start )
+{
+  using namespace std::chrono;
+  return static_cast<uint64_t>( duration_cast<nanoseconds>( steady_clock::now() - start ).count() );
+}
+
+InstrumentedDevice::InstrumentedDevice( Device_sPtr device ) : DeviceDecorator( device )
+{
+  resetStats();
+}
+
+Chimera::Status_t InstrumentedDevice::write( const size_t address, const uint8_t *const data, const size_t length )
+{
+  AK_TRACE_ZONE( "driver::write" );
+
+  auto start  = std::chrono::steady_clock::now();
+  auto result = device->write( address, data, length );
+
+  writeStats.record( length, result, elapsedSince( start ) );
+  return result;
+}
+
+Chimera::Status_t InstrumentedDevice::read( const size_t address, uint8_t *const data, const size_t length )
+{
+  AK_TRACE_ZONE( "driver::read" );
+
+  auto start  = std::chrono::steady_clock::now();
+  auto result = device->read( address, data, length );
+
+  readStats.record( length, result, elapsedSince( start ) );
+  return result;
+}
+
+Chimera::Status_t InstrumentedDevice::erase( const size_t address, const size_t length )
+{
+  AK_TRACE_ZONE( "driver::erase" );
+
+  auto start  = std::chrono::steady_clock::now();
+  auto result = device->erase( address, length );
+
+  eraseStats.record( length, result, elapsedSince( start ) );
+  return result;
+}
+
+InstrumentedDevice::Stats InstrumentedDevice::getStats() const
+{
+  Stats stats;
+  stats.read  = readStats.snapshot();
+  stats.write = writeStats.snapshot();
+  stats.erase = eraseStats.snapshot();
+
+  return stats;
+}
+
+void InstrumentedDevice::resetStats()
+{
+  readStats.reset();
+  writeStats.reset();
+  eraseStats.reset();
+}
+
+void InstrumentedDevice::AtomicOperationStats::reset()
+{
+  count.store( 0, std::memory_order_relaxed );
+  bytes.store( 0, std::memory_order_relaxed );
+  errors.store( 0, std::memory_order_relaxed );
+  totalNs.store( 0, std::memory_order_relaxed );
+  maxNs.store( 0, std::memory_order_relaxed );
+}
+
+void InstrumentedDevice::AtomicOperationStats::record( const size_t length, const Chimera::Status_t result,
+                                                       const uint64_t elapsedNs )
+{
+  count.fetch_add( 1, std::memory_order_relaxed );
+  bytes.fetch_add( length, std::memory_order_relaxed );
+  totalNs.fetch_add( elapsedNs, std::memory_order_relaxed );
+
+  if ( result != Chimera::CommonStatusCodes::OK )
+  {
+    errors.fetch_add( 1, std::memory_order_relaxed );
+  }
+
+  uint64_t currentMax = maxNs.load( std::memory_order_relaxed );
+  while ( ( elapsedNs > currentMax ) && !maxNs.compare_exchange_weak( currentMax, elapsedNs, std::memory_order_relaxed ) )
+  {
+    /* currentMax is refreshed by the failed exchange */
+  }
+}
+
+InstrumentedDevice::OperationStats InstrumentedDevice::AtomicOperationStats::snapshot() const
+{
+  OperationStats stats;
+  stats.count   = count.load( std::memory_order_relaxed );
+  stats.bytes   = bytes.load( std::memory_order_relaxed );
+  stats.errors  = errors.load( std::memory_order_relaxed );
+  stats.totalNs = totalNs.load( std::memory_order_relaxed );
+  stats.maxNs   = maxNs.load( std::memory_order_relaxed );
+
+  return stats;
+}
@@ -0,0 +1,103 @@
+/********************************************************************************
+ *  File Name:
+ *    instrumented_device.hpp
+ *
+ *  Description:
+ *    Memory device wrapper that counts every operation the Parameter Manager
+ *    issues to a driver. Used to see which storage types are doing the most work
+ *    and how much of each call is spent inside the driver itself.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef INSTRUMENTED_DEVICE_HPP
+#define INSTRUMENTED_DEVICE_HPP
+
+/* C++ Includes */
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/* Test Fixture Includes */
+#include <fixtures/device_decorator.hpp>
+
+class InstrumentedDevice : public DeviceDecorator
+{
+public:
+  /**
+   *  Counters for a single kind of operation
+   */
+  struct OperationStats
+  {
+    uint64_t count;     /**< Number of calls made */
+    uint64_t bytes;     /**< Bytes requested across all calls */
+    uint64_t errors;    /**< Calls that did not return OK */
+    uint64_t totalNs;   /**< Time spent inside the wrapped device */
+    uint64_t maxNs;     /**< Slowest single call */
+
+    double averageNs() const
+    {
+      return count ? ( static_cast<double>( totalNs ) / count ) : 0.0;
+    }
+  };
+
+  /**
+   *  Snapshot of every counter at the time getStats() was called
+   */
+  struct Stats
+  {
+    OperationStats read;
+    OperationStats write;
+    OperationStats erase;
+  };
+
+  InstrumentedDevice( Chimera::Modules::Memory::Device_sPtr device );
+  ~InstrumentedDevice() = default;
+
+  Chimera::Status_t write( const size_t address, const uint8_t *const data, const size_t length ) override;
+  Chimera::Status_t read( const size_t address, uint8_t *const data, const size_t length ) override;
+  Chimera::Status_t erase( const size_t address, const size_t length ) override;
+
+  /**
+   *  Takes a snapshot of the counters. Safe to call while other threads are
+   *  using the device, though the individual fields are not captured atomically
+   *  with respect to each other.
+   *
+   *  @return Stats
+   */
+  Stats getStats() const;
+
+  /**
+   *  Zeroes all counters
+   *
+   *  @return void
+   */
+  void resetStats();
+
+private:
+  /**
+   *  Counters are updated with relaxed atomics so several threads can share one
+   *  device without a lock on the I/O path.
+   */
+  struct AtomicOperationStats
+  {
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> errors;
+    std::atomic<uint64_t> totalNs;
+    std::atomic<uint64_t> maxNs;
+
+    void reset();
+    void record( const size_t length, const Chimera::Status_t result, const uint64_t elapsedNs );
+    OperationStats snapshot() const;
+  };
+
+  AtomicOperationStats readStats;
+  AtomicOperationStats writeStats;
+  AtomicOperationStats eraseStats;
+};
+
+using InstrumentedDevice_sPtr = std::shared_ptr<InstrumentedDevice>;
+
+#endif /* !INSTRUMENTED_DEVICE_HPP */
@@ -0,0 +1,283 @@
+/********************************************************************************
+ *  File Name:
+ *    mapped_file_device.cpp
+ *
+ *  Description:
+ *    Memory device backed by a memory mapped file
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#if !defined( _WIN32 )
+
+/* C++ Includes */
+#include <algorithm>
+#include <cstring>
+
+/* POSIX Includes */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Test Fixture Includes */
+#include <fixtures/mapped_file_device.hpp>
+
+using namespace Chimera::CommonStatusCodes;
+
+MappedFileDevice::MappedFileDevice() :
+    fileDescriptor( -1 ), region( nullptr ), regionSize( 0 ),
+    pageSize( static_cast<size_t>( sysconf( _SC_PAGESIZE ) ) ), onWriteComplete( nullptr ), onReadComplete( nullptr ),
+    onEraseComplete( nullptr )
+{
+}
+
+MappedFileDevice::~MappedFileDevice()
+{
+  close();
+}
+
+Chimera::Status_t MappedFileDevice::open( const std::string &path, const size_t size )
+{
+  if ( region || !size )
+  {
+    return INVAL_FUNC_PARAM;
+  }
+
+  fileDescriptor = ::open( path.c_str(), O_RDWR | O_CREAT, 0644 );
+  if ( fileDescriptor < 0 )
+  {
+    return FAIL;
+  }
+
+  /*------------------------------------------------
+  Grow the file if needed so every mapped page is backed. A larger
+  file is left alone so a smaller view can be taken of an old image.
+  ------------------------------------------------*/
+  struct stat fileInfo;
+  if ( fstat( fileDescriptor, &fileInfo ) != 0 )
+  {
+    ::close( fileDescriptor );
+    fileDescriptor = -1;
+    return FAIL;
+  }
+
+  const size_t existingSize = static_cast<size_t>( fileInfo.st_size );
+  if ( ( existingSize < size ) && ( ftruncate( fileDescriptor, size ) != 0 ) )
+  {
+    ::close( fileDescriptor );
+    fileDescriptor = -1;
+    return FAIL;
+  }
+
+  void *mapping = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0 );
+  if ( mapping == MAP_FAILED )
+  {
+    ::close( fileDescriptor );
+    fileDescriptor = -1;
+    return FAIL;
+  }
+
+  region     = static_cast<uint8_t *>( mapping );
+  regionSize = size;
+
+  {
+    std::lock_guard<std::mutex> lock( dirtyLock );
+    dirtyPages.assign( ( size + pageSize - 1 ) / pageSize, false );
+  }
+
+  /*------------------------------------------------
+  ftruncate() zero fills, but a fresh flash part reads back erased. Erase
+  whatever was just grown so new images match the state erase() leaves.
+  ------------------------------------------------*/
+  if ( existingSize < size )
+  {
+    memset( region + existingSize, ErasedValue, size - existingSize );
+    markDirty( existingSize, size - existingSize );
+  }
+
+  return OK;
+}
+
+Chimera::Status_t MappedFileDevice::close()
+{
+  if ( !region )
+  {
+    return OK;
+  }
+
+  auto result = flush();
+
+  munmap( region, regionSize );
+  ::close( fileDescriptor );
+
+  region         = nullptr;
+  regionSize     = 0;
+  fileDescriptor = -1;
+
+  return result;
+}
+
+Chimera::Status_t MappedFileDevice::flush()
+{
+  if ( !region )
+  {
+    return NOT_INITIALIZED;
+  }
+
+  std::lock_guard<std::mutex> lock( dirtyLock );
+
+  /*------------------------------------------------
+  Coalesce runs of dirty pages so each contiguous run costs one msync
+  ------------------------------------------------*/
+  Chimera::Status_t result = OK;
+  size_t page              = 0;
+
+  while ( page < dirtyPages.size() )
+  {
+    if ( !dirtyPages[ page ] )
+    {
+      page++;
+      continue;
+    }
+
+    size_t runStart = page;
+    while ( ( page < dirtyPages.size() ) && dirtyPages[ page ] )
+    {
+      dirtyPages[ page ] = false;
+      page++;
+    }
+
+    const size_t offset = runStart * pageSize;
+    const size_t length = std::min( page * pageSize, regionSize ) - offset;
+
+    if ( msync( region + offset, length, MS_SYNC ) != 0 )
+    {
+      result = FAIL;
+    }
+  }
+
+  return result;
+}
+
+size_t MappedFileDevice::size() const
+{
+  return regionSize;
+}
+
+const uint8_t *MappedFileDevice::data() const
+{
+  return region;
+}
+
+Chimera::Status_t MappedFileDevice::write( const size_t address, const uint8_t *const data, const size_t length )
+{
+  if ( !region )
+  {
+    return NOT_INITIALIZED;
+  }
+  else if ( !data || !inBounds( address, length ) )
+  {
+    return INVAL_FUNC_PARAM;
+  }
+
+  memcpy( region + address, data, length );
+  markDirty( address, length );
+
+  if ( onWriteComplete )
+  {
+    onWriteComplete( static_cast<uint32_t>( length ) );
+  }
+
+  return OK;
+}
+
+Chimera::Status_t MappedFileDevice::read( const size_t address, uint8_t *const data, const size_t length )
+{
+  if ( !region )
+  {
+    return NOT_INITIALIZED;
+  }
+  else if ( !data || !inBounds( address, length ) )
+  {
+    return INVAL_FUNC_PARAM;
+  }
+
+  memcpy( data, region + address, length );
+
+  if ( onReadComplete )
+  {
+    onReadComplete( static_cast<uint32_t>( length ) );
+  }
+
+  return OK;
+}
+
+Chimera::Status_t MappedFileDevice::erase( const size_t address, const size_t length )
+{
+  if ( !region )
+  {
+    return NOT_INITIALIZED;
+  }
+  else if ( !inBounds( address, length ) )
+  {
+    return INVAL_FUNC_PARAM;
+  }
+
+  memset( region + address, ErasedValue, length );
+  markDirty( address, length );
+
+  if ( onEraseComplete )
+  {
+    onEraseComplete( static_cast<uint32_t>( length ) );
+  }
+
+  return OK;
+}
+
+Chimera::Status_t MappedFileDevice::writeCompleteCallback( const Chimera::void_func_uint32_t func )
+{
+  onWriteComplete = func;
+  return OK;
+}
+
+Chimera::Status_t MappedFileDevice::readCompleteCallback( const Chimera::void_func_uint32_t func )
+{
+  onReadComplete = func;
+  return OK;
+}
+
+Chimera::Status_t MappedFileDevice::eraseCompleteCallback( const Chimera::void_func_uint32_t func )
+{
+  onEraseComplete = func;
+  return OK;
+}
+
+bool MappedFileDevice::isInitialized()
+{
+  return region != nullptr;
+}
+
+bool MappedFileDevice::inBounds( const size_t address, const size_t length ) const
+{
+  return ( address < regionSize ) && ( length <= ( regionSize - address ) );
+}
+
+void MappedFileDevice::markDirty( const size_t address, const size_t length )
+{
+  if ( !length )
+  {
+    return;
+  }
+
+  const size_t firstPage = address / pageSize;
+  const size_t lastPage  = ( address + length - 1 ) / pageSize;
+
+  std::lock_guard<std::mutex> lock( dirtyLock );
+  for ( size_t page = firstPage; page <= lastPage; page++ )
+  {
+    dirtyPages[ page ] = true;
+  }
+}
+
+#endif /* !_WIN32 */
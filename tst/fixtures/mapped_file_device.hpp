@@ -0,0 +1,114 @@
+/********************************************************************************
+ *  File Name:
+ *    mapped_file_device.hpp
+ *
+ *  Description:
+ *    Memory device backed by a memory mapped file. Lets a host simulation keep
+ *    its parameter store between runs, come back up without a load step and
+ *    expose the raw image to external tools. POSIX hosts only.
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef MAPPED_FILE_DEVICE_HPP
+#define MAPPED_FILE_DEVICE_HPP
+
+#if !defined( _WIN32 )
+
+/* C++ Includes */
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* Chimera Includes */
+#include <Chimera/modules/memory/device.hpp>
+
+class MappedFileDevice : public Chimera::Modules::Memory::Device
+{
+public:
+  /**
+   *  Value written by erase(), matching the erased state of NOR flash
+   */
+  static constexpr uint8_t ErasedValue = 0xFF;
+
+  MappedFileDevice();
+  ~MappedFileDevice();
+
+  /**
+   *  Maps a file into memory, creating it if needed. An existing file keeps its
+   *  contents. A file that is too small is grown, and the new bytes are erased
+   *  to ErasedValue, the same as a blank flash part.
+   *
+   *  @param[in]  path      File that backs the device
+   *  @param[in]  size      Number of bytes the device exposes
+   *  @return Chimera::Status_t
+   *
+   *  |   Return Value   |             Explanation            |
+   *  |:----------------:|:----------------------------------:|
+   *  |               OK | The file is mapped and ready       |
+   *  | INVAL_FUNC_PARAM | Zero size or a file is already open|
+   *  |             FAIL | The file could not be opened/mapped|
+   */
+  Chimera::Status_t open( const std::string &path, const size_t size );
+
+  /**
+   *  Flushes any dirty pages and unmaps the file
+   *
+   *  @return Chimera::Status_t
+   */
+  Chimera::Status_t close();
+
+  /**
+   *  Synchronously writes every page modified since the last flush back to the
+   *  file. Only whole pages that were touched are passed to msync().
+   *
+   *  @return Chimera::Status_t
+   */
+  Chimera::Status_t flush();
+
+  /**
+   *  Gets the number of bytes exposed by the device
+   *
+   *  @return size_t
+   */
+  size_t size() const;
+
+  /**
+   *  Gets a read only view of the mapped image, for inspection by tests and tools
+   *
+   *  @return const uint8_t *
+   */
+  const uint8_t *data() const;
+
+  Chimera::Status_t write( const size_t address, const uint8_t *const data, const size_t length ) override;
+  Chimera::Status_t read( const size_t address, uint8_t *const data, const size_t length ) override;
+  Chimera::Status_t erase( const size_t address, const size_t length ) override;
+  Chimera::Status_t writeCompleteCallback( const Chimera::void_func_uint32_t func ) override;
+  Chimera::Status_t readCompleteCallback( const Chimera::void_func_uint32_t func ) override;
+  Chimera::Status_t eraseCompleteCallback( const Chimera::void_func_uint32_t func ) override;
+  bool isInitialized() override;
+
+private:
+  bool inBounds( const size_t address, const size_t length ) const;
+  void markDirty( const size_t address, const size_t length );
+
+  int fileDescriptor;
+  uint8_t *region;
+  size_t regionSize;
+  size_t pageSize;
+
+  std::mutex dirtyLock;
+  std::vector<bool> dirtyPages;
+
+  Chimera::void_func_uint32_t onWriteComplete;
+  Chimera::void_func_uint32_t onReadComplete;
+  Chimera::void_func_uint32_t onEraseComplete;
+};
+
+using MappedFileDevice_sPtr = std::shared_ptr<MappedFileDevice>;
+
+#endif /* !_WIN32 */
+#endif /* !MAPPED_FILE_DEVICE_HPP */
@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 #include <AeroKernel/parameter.hpp>
 #include <Chimera/modules/memory/device.hpp>
+#include <fixtures/virtual_memory_fixture.hpp>
 
 class PMTF : public ::testing::Test
 {
@@ -39,28 +40,4 @@ protected:
   AeroKernel::Parameter::Manager *pm = nullptr;
 };
 
-/*------------------------------------------------
-Virtual Memory Region Resources
-------------------------------------------------*/
-static constexpr size_t KB = 1024;
-static constexpr size_t MB = 1024 * 1024;
-
-static constexpr size_t InternalSRAM_ByteSize   = 4 * KB;
-static constexpr size_t InternalFLASH_ByteSize  = 4 * KB;
-static constexpr size_t ExternalFLASH0_ByteSize = 1 * MB;
-static constexpr size_t ExternalFLASH1_ByteSize = 512 * KB;
-static constexpr size_t ExternalFLASH2_ByteSize = 64 * KB;
-static constexpr size_t ExternalSRAM0_ByteSize  = 512 * KB;
-static constexpr size_t ExternalSRAM1_ByteSize  = 64 * KB;
-static constexpr size_t ExternalSRAM2_ByteSize  = 8 * KB;
-
-extern Chimera::Modules::Memory::VMD_sPtr InternalSRAM_VMD;
-extern Chimera::Modules::Memory::VMD_sPtr InternalFLASH_VMD;
-extern Chimera::Modules::Memory::VMD_sPtr ExternalFLASH0_VMD;
-extern Chimera::Modules::Memory::VMD_sPtr ExternalFLASH1_VMD;
-extern Chimera::Modules::Memory::VMD_sPtr ExternalFLASH2_VMD;
-extern Chimera::Modules::Memory::VMD_sPtr ExternalSRAM0_VMD;
-extern Chimera::Modules::Memory::VMD_sPtr ExternalSRAM1_VMD;
-extern Chimera::Modules::Memory::VMD_sPtr ExternalSRAM2_VMD;
-
 #endif /* !PARAMETER_MANAGER_TEST_FIXTURE_HPP */
\ No newline at end of file
@@ -0,0 +1,171 @@
+/********************************************************************************
+ *  File Name:
+ *    trace_recorder.cpp
+ *
+ *  Description:
+ *    Scoped instrumentation for profiling the host simulation
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/* Test Fixture Includes */
+#include <fixtures/trace_recorder.hpp>
+
+namespace AeroKernel::Trace
+{
+  struct Buffer
+  {
+    std::unique_ptr<Record[]> records;
+    size_t capacity;
+  };
+
+  static const auto s_epoch = std::chrono::steady_clock::now();
+
+  static std::unique_ptr<Buffer> s_storage;
+  static std::mutex s_init_lock;
+  static std::atomic<Buffer *> s_buffer( nullptr );
+  static std::atomic<size_t> s_writers( 0 );
+  static std::atomic<size_t> s_next( 0 );
+  static std::atomic<size_t> s_dropped( 0 );
+  static std::atomic<uint32_t> s_next_thread_id( 0 );
+
+  static uint32_t threadId()
+  {
+    thread_local const uint32_t id = s_next_thread_id.fetch_add( 1, std::memory_order_relaxed );
+    return id;
+  }
+
+  /**
+   *  Writes a zone name as a JSON string, escaping anything JSON does not
+   *  allow raw
+   */
+  static void writeName( std::ostream &stream, const char *const name )
+  {
+    stream << '"';
+    for ( const char *c = name; *c; c++ )
+    {
+      const unsigned char ch = static_cast<unsigned char>( *c );
+
+      if ( ( ch == '"' ) || ( ch == '\\' ) )
+      {
+        stream << '\\' << *c;
+      }
+      else if ( ch < 0x20 )
+      {
+        char escaped[ 8 ];
+        snprintf( escaped, sizeof( escaped ), "\\u%04x", ch );
+        stream << escaped;
+      }
+      else
+      {
+        stream << *c;
+      }
+    }
+    stream << '"';
+  }
+
+  void initialize( const size_t maxRecords )
+  {
+    std::lock_guard<std::mutex> lock( s_init_lock );
+
+    /*------------------------------------------------
+    Take the buffer away from new zones, then wait out any record() that
+    already holds it before it is freed
+    ------------------------------------------------*/
+    s_buffer.store( nullptr );
+    while ( s_writers.load() )
+    {
+      std::this_thread::yield();
+    }
+
+    s_storage           = std::make_unique<Buffer>();
+    s_storage->records  = std::make_unique<Record[]>( maxRecords );
+    s_storage->capacity = maxRecords;
+
+    s_next.store( 0 );
+    s_dropped.store( 0 );
+    s_buffer.store( s_storage.get() );
+  }
+
+  void record( const char *const name, const uint64_t startNs, const uint64_t endNs )
+  {
+    s_writers.fetch_add( 1 );
+    Buffer *const buffer = s_buffer.load();
+
+    const size_t slot = buffer ? s_next.fetch_add( 1, std::memory_order_relaxed ) : 0;
+    if ( !buffer || ( slot >= buffer->capacity ) )
+    {
+      s_dropped.fetch_add( 1, std::memory_order_relaxed );
+      s_writers.fetch_sub( 1, std::memory_order_release );
+      return;
+    }
+
+    const uint64_t duration = endNs - startNs;
+
+    Record &entry    = buffer->records[ slot ];
+    entry.name       = name;
+    entry.startNs    = startNs;
+    entry.durationNs = static_cast<uint32_t>( std::min<uint64_t>( duration, std::numeric_limits<uint32_t>::max() ) );
+    entry.threadId   = threadId();
+
+    s_writers.fetch_sub( 1, std::memory_order_release );
+  }
+
+  uint64_t now()
+  {
+    using namespace std::chrono;
+    return static_cast<uint64_t>( duration_cast<nanoseconds>( steady_clock::now() - s_epoch ).count() );
+  }
+
+  std::vector<Record> records()
+  {
+    std::lock_guard<std::mutex> lock( s_init_lock );
+
+    const Buffer *const buffer = s_buffer.load();
+    if ( !buffer )
+    {
+      return {};
+    }
+
+    const size_t count = std::min( s_next.load(), buffer->capacity );
+    return std::vector<Record>( buffer->records.get(), buffer->records.get() + count );
+  }
+
+  size_t dropped()
+  {
+    return s_dropped.load();
+  }
+
+  void writeChromeTrace( std::ostream &stream )
+  {
+    /*------------------------------------------------
+    Complete ("X") events use microsecond timestamps; three decimal
+    places keeps the nanosecond resolution of the records.
+    ------------------------------------------------*/
+    stream << std::fixed << std::setprecision( 3 );
+    stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool first = true;
+    for ( const auto &entry : records() )
+    {
+      stream << ( first ? "\n" : ",\n" ) << "{\"name\":";
+      writeName( stream, entry.name );
+      stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << entry.threadId;
+      stream << ",\"ts\":" << ( entry.startNs / 1.0e3 ) << ",\"dur\":" << ( entry.durationNs / 1.0e3 ) << "}";
+      first = false;
+    }
+
+    stream << "\n]}\n";
+  }
+}  // namespace AeroKernel::Trace
@@ -0,0 +1,73 @@
+/********************************************************************************
+ *  File Name:
+ *    trace_recorder.hpp
+ *
+ *  Description:
+ *    Host recorder behind the AK_TRACE_ZONE macros in AeroKernel/trace.hpp.
+ *    Zones are stored as compact begin/duration records in a preallocated
+ *    buffer which can then be exported in the Chrome trace event format
+ *    (loadable by chrome://tracing and Perfetto).
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef TRACE_RECORDER_HPP
+#define TRACE_RECORDER_HPP
+
+/* C++ Includes */
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/* AeroKernel Includes */
+#include <AeroKernel/trace.hpp>
+
+namespace AeroKernel::Trace
+{
+  /**
+   *  One completed zone
+   */
+  struct Record
+  {
+    const char *name;     /**< Zone name */
+    uint64_t startNs;     /**< Start time relative to the trace epoch */
+    uint32_t durationNs;  /**< Zone length, saturated at ~4.2 seconds */
+    uint32_t threadId;    /**< Small sequential id of the recording thread */
+  };
+
+  /**
+   *  Allocates the record buffer and discards anything already recorded. Zones
+   *  are dropped until this has been called. Safe to call again while other
+   *  threads are recording; zones that race with it are dropped.
+   *
+   *  @param[in]  maxRecords    Number of records to keep before dropping new ones
+   *  @return void
+   */
+  void initialize( const size_t maxRecords );
+
+  /**
+   *  Copies out every record stored so far
+   *
+   *  @return std::vector<Record>
+   */
+  std::vector<Record> records();
+
+  /**
+   *  Gets how many zones were discarded because the buffer was full
+   *
+   *  @return size_t
+   */
+  size_t dropped();
+
+  /**
+   *  Writes all records as a Chrome trace event JSON document
+   *
+   *  @param[in]  stream    Where to write the document
+   *  @return void
+   */
+  void writeChromeTrace( std::ostream &stream );
+}  // namespace AeroKernel::Trace
+
+#endif /* !TRACE_RECORDER_HPP */
@@ -0,0 +1,159 @@
+/********************************************************************************
+ *  File Name:
+ *    virtual_memory_fixture.cpp
+ *
+ *  Description:
+ *    Virtual memory devices that back each Parameter Manager storage type when
+ *    running on the host.
+ *
+ *  2019 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#include <fixtures/virtual_memory_fixture.hpp>
+
+using namespace AeroKernel::Parameter;
+using namespace Chimera::Modules::Memory;
+
+static std::array<uint8_t, InternalSRAM_ByteSize> mock_internal_sram_region;
+static std::array<uint8_t, InternalFLASH_ByteSize> mock_internal_flash_region;
+static std::array<uint8_t, ExternalFLASH0_ByteSize> mock_external_flash0_region;
+static std::array<uint8_t, ExternalFLASH1_ByteSize> mock_external_flash1_region;
+static std::array<uint8_t, ExternalFLASH2_ByteSize> mock_external_flash2_region;
+static std::array<uint8_t, ExternalSRAM0_ByteSize> mock_external_sram0_region;
+static std::array<uint8_t, ExternalSRAM1_ByteSize> mock_external_sram1_region;
+static std::array<uint8_t, ExternalSRAM2_ByteSize> mock_external_sram2_region;
+
+VMD_sPtr InternalSRAM_VMD   = std::make_shared<VirtualMemoryDevice>();
+VMD_sPtr InternalFLASH_VMD  = std::make_shared<VirtualMemoryDevice>();
+VMD_sPtr ExternalFLASH0_VMD = std::make_shared<VirtualMemoryDevice>();
+VMD_sPtr ExternalFLASH1_VMD = std::make_shared<VirtualMemoryDevice>();
+VMD_sPtr ExternalFLASH2_VMD = std::make_shared<VirtualMemoryDevice>();
+VMD_sPtr ExternalSRAM0_VMD  = std::make_shared<VirtualMemoryDevice>();
+VMD_sPtr ExternalSRAM1_VMD  = std::make_shared<VirtualMemoryDevice>();
+VMD_sPtr ExternalSRAM2_VMD  = std::make_shared<VirtualMemoryDevice>();
+
+void resetVirtualMemory()
+{
+  InternalSRAM_VMD->initialize( mock_internal_sram_region );
+  InternalSRAM_VMD->erase( 0, InternalSRAM_ByteSize );
+
+  InternalFLASH_VMD->initialize( mock_internal_flash_region );
+  InternalFLASH_VMD->erase( 0, InternalFLASH_ByteSize );
+  
+  ExternalFLASH0_VMD->initialize( mock_external_flash0_region );
+  ExternalFLASH0_VMD->erase( 0, ExternalFLASH0_ByteSize );
+  
+  ExternalFLASH1_VMD->initialize( mock_external_flash1_region );
+  ExternalFLASH1_VMD->erase( 0, ExternalFLASH1_ByteSize );
+  
+  ExternalFLASH2_VMD->initialize( mock_external_flash2_region );
+  ExternalFLASH2_VMD->erase( 0, ExternalFLASH2_ByteSize );
+  
+  ExternalSRAM0_VMD->initialize( mock_external_sram0_region );
+  ExternalSRAM0_VMD->erase( 0, ExternalSRAM0_ByteSize );
+  
+  ExternalSRAM1_VMD->initialize( mock_external_sram1_region );
+  ExternalSRAM1_VMD->erase( 0, ExternalSRAM1_ByteSize );
+  
+  ExternalSRAM2_VMD->initialize( mock_external_sram2_region );
+  ExternalSRAM2_VMD->erase( 0, ExternalSRAM2_ByteSize );
+}
+
+VMD_sPtr getVirtualMemoryDevice( const StorageType type )
+{
+  switch ( type )
+  {
+    case StorageType::INTERNAL_SRAM:
+      return InternalSRAM_VMD;
+
+    case StorageType::INTERNAL_FLASH:
+      return InternalFLASH_VMD;
+
+    case StorageType::EXTERNAL_FLASH0:
+      return ExternalFLASH0_VMD;
+
+    case StorageType::EXTERNAL_FLASH1:
+      return ExternalFLASH1_VMD;
+
+    case StorageType::EXTERNAL_FLASH2:
+      return ExternalFLASH2_VMD;
+
+    case StorageType::EXTERNAL_SRAM0:
+      return ExternalSRAM0_VMD;
+
+    case StorageType::EXTERNAL_SRAM1:
+      return ExternalSRAM1_VMD;
+
+    case StorageType::EXTERNAL_SRAM2:
+      return ExternalSRAM2_VMD;
+
+    default:
+      return nullptr;
+  }
+}
+
+size_t getVirtualMemorySize( const StorageType type )
+{
+  switch ( type )
+  {
+    case StorageType::INTERNAL_SRAM:
+      return InternalSRAM_ByteSize;
+
+    case StorageType::INTERNAL_FLASH:
+      return InternalFLASH_ByteSize;
+
+    case StorageType::EXTERNAL_FLASH0:
+      return ExternalFLASH0_ByteSize;
+
+    case StorageType::EXTERNAL_FLASH1:
+      return ExternalFLASH1_ByteSize;
+
+    case StorageType::EXTERNAL_FLASH2:
+      return ExternalFLASH2_ByteSize;
+
+    case StorageType::EXTERNAL_SRAM0:
+      return ExternalSRAM0_ByteSize;
+
+    case StorageType::EXTERNAL_SRAM1:
+      return ExternalSRAM1_ByteSize;
+
+    case StorageType::EXTERNAL_SRAM2:
+      return ExternalSRAM2_ByteSize;
+
+    default:
+      return 0;
+  }
+}
+
+const char *getStorageName( const StorageType type )
+{
+  switch ( type )
+  {
+    case StorageType::INTERNAL_SRAM:
+      return "INTERNAL_SRAM";
+
+    case StorageType::INTERNAL_FLASH:
+      return "INTERNAL_FLASH";
+
+    case StorageType::EXTERNAL_FLASH0:
+      return "EXTERNAL_FLASH0";
+
+    case StorageType::EXTERNAL_FLASH1:
+      return "EXTERNAL_FLASH1";
+
+    case StorageType::EXTERNAL_FLASH2:
+      return "EXTERNAL_FLASH2";
+
+    case StorageType::EXTERNAL_SRAM0:
+      return "EXTERNAL_SRAM0";
+
+    case StorageType::EXTERNAL_SRAM1:
+      return "EXTERNAL_SRAM1";
+
+    case StorageType::EXTERNAL_SRAM2:
+      return "EXTERNAL_SRAM2";
+
+    default:
+      return "NONE";
+  }
+}
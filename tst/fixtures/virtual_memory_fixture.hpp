@@ -0,0 +1,97 @@
+/********************************************************************************
+ *  File Name:
+ *    virtual_memory_fixture.hpp
+ *
+ *  Description:
+ *    Virtual memory devices that back each Parameter Manager storage type when
+ *    running on the host. Shared by the unit tests and the benchmark suite.
+ *
+ *  2019 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#pragma once
+#ifndef VIRTUAL_MEMORY_FIXTURE_HPP
+#define VIRTUAL_MEMORY_FIXTURE_HPP
+
+/* C++ Includes */
+#include <array>
+#include <cstddef>
+
+/* Chimera Includes */
+#include <Chimera/modules/memory/device.hpp>
+
+/* AeroKernel Includes */
+#include <AeroKernel/parameter.hpp>
+
+/*------------------------------------------------
+Virtual Memory Region Resources
+------------------------------------------------*/
+static constexpr size_t KB = 1024;
+static constexpr size_t MB = 1024 * 1024;
+
+static constexpr size_t InternalSRAM_ByteSize   = 4 * KB;
+static constexpr size_t InternalFLASH_ByteSize  = 4 * KB;
+static constexpr size_t ExternalFLASH0_ByteSize = 1 * MB;
+static constexpr size_t ExternalFLASH1_ByteSize = 512 * KB;
+static constexpr size_t ExternalFLASH2_ByteSize = 64 * KB;
+static constexpr size_t ExternalSRAM0_ByteSize  = 512 * KB;
+static constexpr size_t ExternalSRAM1_ByteSize  = 64 * KB;
+static constexpr size_t ExternalSRAM2_ByteSize  = 8 * KB;
+
+extern Chimera::Modules::Memory::VMD_sPtr InternalSRAM_VMD;
+extern Chimera::Modules::Memory::VMD_sPtr InternalFLASH_VMD;
+extern Chimera::Modules::Memory::VMD_sPtr ExternalFLASH0_VMD;
+extern Chimera::Modules::Memory::VMD_sPtr ExternalFLASH1_VMD;
+extern Chimera::Modules::Memory::VMD_sPtr ExternalFLASH2_VMD;
+extern Chimera::Modules::Memory::VMD_sPtr ExternalSRAM0_VMD;
+extern Chimera::Modules::Memory::VMD_sPtr ExternalSRAM1_VMD;
+extern Chimera::Modules::Memory::VMD_sPtr ExternalSRAM2_VMD;
+
+/**
+ *  Every storage type that can have a memory driver attached, in bitfield order
+ *  (see requirement PM002.2.3).
+ */
+static constexpr std::array<AeroKernel::Parameter::StorageType, 8> AllStorageTypes = {
+  AeroKernel::Parameter::StorageType::INTERNAL_SRAM,   AeroKernel::Parameter::StorageType::INTERNAL_FLASH,
+  AeroKernel::Parameter::StorageType::EXTERNAL_FLASH0, AeroKernel::Parameter::StorageType::EXTERNAL_FLASH1,
+  AeroKernel::Parameter::StorageType::EXTERNAL_FLASH2, AeroKernel::Parameter::StorageType::EXTERNAL_SRAM0,
+  AeroKernel::Parameter::StorageType::EXTERNAL_SRAM1,  AeroKernel::Parameter::StorageType::EXTERNAL_SRAM2
+};
+
+/**
+ *  Re-attaches every virtual memory device to its backing region and erases it
+ *
+ *  @return void
+ */
+void resetVirtualMemory();
+
+/**
+ *  Looks up the virtual memory device that backs a storage type
+ *
+ *  @param[in]  type      The storage type to look up
+ *  @return Chimera::Modules::Memory::VMD_sPtr
+ *
+ *  |  Return Value |        Explanation       |
+ *  |:-------------:|:------------------------:|
+ *  |       nullptr | No device for that type  |
+ *  |      !nullptr | The backing device       |
+ */
+Chimera::Modules::Memory::VMD_sPtr getVirtualMemoryDevice( const AeroKernel::Parameter::StorageType type );
+
+/**
+ *  Gets the number of bytes available in the region backing a storage type
+ *
+ *  @param[in]  type      The storage type to look up
+ *  @return size_t
+ */
+size_t getVirtualMemorySize( const AeroKernel::Parameter::StorageType type );
+
+/**
+ *  Gets a printable name for a storage type, matching the enumerator name
+ *
+ *  @param[in]  type      The storage type to name
+ *  @return const char *
+ */
+const char *getStorageName( const AeroKernel::Parameter::StorageType type );
+
+#endif /* !VIRTUAL_MEMORY_FIXTURE_HPP */
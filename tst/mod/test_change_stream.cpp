@@ -0,0 +1,307 @@
+/********************************************************************************
+ *  File Name:
+ *    test_change_stream.cpp
+ *
+ *  Description:
+ *    Tests for the shared memory parameter change stream
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#if !defined( _WIN32 )
+
+/* C++ Includes */
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+/* POSIX Includes */
+#include <unistd.h>
+
+/* Test Driver Includes */
+#include <gtest/gtest.h>
+#include <fixtures/parameter_test_fixture.hpp>
+#include <fixtures/change_stream.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+class ChangeStreamTest : public PMTF
+{
+protected:
+  virtual void SetUp() override
+  {
+    PMTF::SetUp();
+
+    char name[] = "/tmp/aerokernel_stream_XXXXXX";
+    int fd      = mkstemp( name );
+    ASSERT_GE( fd, 0 );
+    ::close( fd );
+
+    path   = name;
+    writer = std::make_shared<ChangeStream::Writer>();
+  }
+
+  virtual void TearDown() override
+  {
+    writer->close();
+    unlink( path.c_str() );
+    PMTF::TearDown();
+  }
+
+  std::string path;
+  std::shared_ptr<ChangeStream::Writer> writer;
+};
+
+TEST_F( ChangeStreamTest, readerRejectsMissingRing )
+{
+  ChangeStream::Reader reader;
+  ChangeStream::Record record;
+
+  EXPECT_EQ( false, reader.open( path ) );
+  EXPECT_EQ( 0u, reader.poll( &record, 1 ) );
+}
+
+TEST_F( ChangeStreamTest, parameterWriteIsStreamed )
+{
+  using namespace AeroKernel::Parameter;
+  using namespace Chimera::Modules::Memory;
+
+  uint32_t pod               = 0x12345678;
+  const std::string_view key = "pod";
+  const auto channel         = static_cast<uint32_t>( StorageType::INTERNAL_SRAM );
+
+  ASSERT_EQ( true, writer->open( path, 16, ChangeStream::Backpressure::DROP_NEWEST ) );
+  Device_sPtr driver = std::make_shared<ChangeStreamDevice>( InternalSRAM_VMD, writer, channel );
+
+  ControlBlockFactory factory;
+  factory.setAddress( 0x10 );
+  factory.setSize( sizeof( pod ) );
+  factory.setStorage( StorageType::INTERNAL_SRAM );
+  factory.setUpdateCallback( nullptr );
+
+  pm->init( 50 );
+  pm->registerParameter( key, factory.build() );
+  pm->registerMemoryDriver( StorageType::INTERNAL_SRAM, driver );
+
+  ChangeStream::Reader reader;
+  ChangeStream::Record record;
+  ASSERT_EQ( true, reader.open( path ) );
+
+  EXPECT_EQ( true, pm->write( key, &pod ) );
+  EXPECT_EQ( 0u, reader.poll( &record, 1 ) );
+
+  writer->publish();
+  ASSERT_EQ( 1u, reader.poll( &record, 1 ) );
+
+  uint32_t streamed = 0;
+  memcpy( &streamed, record.data, sizeof( streamed ) );
+
+  EXPECT_EQ( 0u, record.sequence );
+  EXPECT_EQ( channel, record.channel );
+  EXPECT_EQ( 0x10u, record.address );
+  EXPECT_EQ( sizeof( pod ), record.length );
+  EXPECT_EQ( pod, streamed );
+  EXPECT_EQ( 0u, reader.poll( &record, 1 ) );
+}
+
+TEST_F( ChangeStreamTest, longValuesAreSplit )
+{
+  std::array<uint8_t, ChangeStream::MaxInlineBytes + 5> value;
+  std::array<ChangeStream::Record, 4> records;
+
+  for ( size_t x = 0; x < value.size(); x++ )
+  {
+    value[ x ] = static_cast<uint8_t>( x );
+  }
+
+  ASSERT_EQ( true, writer->open( path, 16, ChangeStream::Backpressure::DROP_NEWEST ) );
+  ChangeStreamDevice device( InternalSRAM_VMD, writer, 0 );
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, device.write( 0x100, value.data(), value.size() ) );
+  writer->publish();
+
+  ChangeStream::Reader reader;
+  ASSERT_EQ( true, reader.open( path ) );
+  ASSERT_EQ( 2u, reader.poll( records.data(), records.size() ) );
+
+  EXPECT_EQ( 0x100u, records[ 0 ].address );
+  EXPECT_EQ( ChangeStream::MaxInlineBytes, records[ 0 ].length );
+  EXPECT_EQ( 0x100u + ChangeStream::MaxInlineBytes, records[ 1 ].address );
+  EXPECT_EQ( 5u, records[ 1 ].length );
+  EXPECT_EQ( value[ ChangeStream::MaxInlineBytes ], records[ 1 ].data[ 0 ] );
+  EXPECT_EQ( records[ 0 ].timestampNs, records[ 1 ].timestampNs );
+}
+
+TEST_F( ChangeStreamTest, nothingVisibleUntilPublish )
+{
+  uint8_t data = 0xA5;
+  std::array<ChangeStream::Record, 4> records;
+
+  ASSERT_EQ( true, writer->open( path, 16, ChangeStream::Backpressure::DROP_NEWEST ) );
+  ChangeStream::Reader reader;
+  ASSERT_EQ( true, reader.open( path ) );
+
+  writer->push( 0, 0, &data, 1 );
+  writer->push( 0, 1, &data, 1 );
+  EXPECT_EQ( 0u, reader.poll( records.data(), records.size() ) );
+
+  writer->publish();
+  EXPECT_EQ( 2u, reader.poll( records.data(), records.size() ) );
+}
+
+TEST_F( ChangeStreamTest, batchSizePublishesAutomatically )
+{
+  uint8_t data = 0;
+  std::array<ChangeStream::Record, 8> records;
+
+  ASSERT_EQ( true, writer->open( path, 16, ChangeStream::Backpressure::DROP_NEWEST ) );
+  writer->setBatchSize( 4 );
+
+  ChangeStreamDevice device( InternalSRAM_VMD, writer, 0 );
+  ChangeStream::Reader reader;
+  ASSERT_EQ( true, reader.open( path ) );
+
+  for ( uint32_t x = 0; x < 3; x++ )
+  {
+    EXPECT_EQ( Chimera::CommonStatusCodes::OK, device.write( x, &data, 1 ) );
+  }
+  EXPECT_EQ( 0u, reader.poll( records.data(), records.size() ) );
+
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, device.write( 3, &data, 1 ) );
+  ASSERT_EQ( 4u, reader.poll( records.data(), records.size() ) );
+  EXPECT_EQ( 3u, records[ 3 ].address );
+
+  /*------------------------------------------------
+  A partial batch waits for the flush
+  ------------------------------------------------*/
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, device.write( 4, &data, 1 ) );
+  EXPECT_EQ( 0u, reader.poll( records.data(), records.size() ) );
+  writer->publish();
+  EXPECT_EQ( 1u, reader.poll( records.data(), records.size() ) );
+}
+
+TEST_F( ChangeStreamTest, dropNewestWhenFull )
+{
+  uint8_t data = 0;
+  std::array<ChangeStream::Record, 8> records;
+
+  ASSERT_EQ( true, writer->open( path, 4, ChangeStream::Backpressure::DROP_NEWEST ) );
+  ChangeStream::Reader reader;
+  ASSERT_EQ( true, reader.open( path ) );
+
+  for ( uint32_t x = 0; x < 6; x++ )
+  {
+    EXPECT_EQ( x < 4, writer->push( 0, x, &data, 1 ) );
+  }
+  writer->publish();
+
+  EXPECT_EQ( 2u, reader.dropped() );
+  ASSERT_EQ( 4u, reader.poll( records.data(), records.size() ) );
+  EXPECT_EQ( 0u, records[ 0 ].address );
+  EXPECT_EQ( 3u, records[ 3 ].address );
+
+  /*------------------------------------------------
+  Space freed by the reader is usable again, and the two dropped
+  records show up as a gap in the sequence
+  ------------------------------------------------*/
+  EXPECT_EQ( true, writer->push( 0, 9, &data, 1 ) );
+  writer->publish();
+  ASSERT_EQ( 1u, reader.poll( records.data(), records.size() ) );
+  EXPECT_EQ( 6u, records[ 0 ].sequence );
+}
+
+TEST_F( ChangeStreamTest, splitValueIsNeverTorn )
+{
+  std::array<uint8_t, ( 2 * ChangeStream::MaxInlineBytes ) + 1> value;
+  std::array<ChangeStream::Record, 8> records;
+  value.fill( 0x5A );
+
+  ASSERT_EQ( true, writer->open( path, 4, ChangeStream::Backpressure::DROP_NEWEST ) );
+  ChangeStream::Reader reader;
+  ASSERT_EQ( true, reader.open( path ) );
+
+  /*------------------------------------------------
+  Two free slots cannot hold a three record value, so none of it is written
+  ------------------------------------------------*/
+  EXPECT_EQ( true, writer->push( 0, 0, value.data(), 1 ) );
+  EXPECT_EQ( true, writer->push( 0, 1, value.data(), 1 ) );
+  EXPECT_EQ( false, writer->push( 0, 2, value.data(), value.size() ) );
+  writer->publish();
+
+  EXPECT_EQ( 3u, reader.dropped() );
+  ASSERT_EQ( 2u, reader.poll( records.data(), records.size() ) );
+  EXPECT_EQ( 1u, records[ 1 ].sequence );
+
+  /*------------------------------------------------
+  Once there is room the whole value goes through, after a sequence gap
+  ------------------------------------------------*/
+  EXPECT_EQ( true, writer->push( 0, 2, value.data(), value.size() ) );
+  writer->publish();
+  ASSERT_EQ( 3u, reader.poll( records.data(), records.size() ) );
+  EXPECT_EQ( 5u, records[ 0 ].sequence );
+  EXPECT_EQ( 7u, records[ 2 ].sequence );
+  EXPECT_EQ( 1u, records[ 2 ].length );
+}
+
+TEST_F( ChangeStreamTest, valueLargerThanRingIsDropped )
+{
+  std::array<uint8_t, ( 2 * ChangeStream::MaxInlineBytes ) + 1> value;
+  std::array<ChangeStream::Record, 4> records;
+  value.fill( 0 );
+
+  ASSERT_EQ( true, writer->open( path, 2, ChangeStream::Backpressure::BLOCK ) );
+  ChangeStream::Reader reader;
+  ASSERT_EQ( true, reader.open( path ) );
+
+  EXPECT_EQ( false, writer->push( 0, 0, value.data(), value.size() ) );
+  writer->publish();
+
+  EXPECT_EQ( 3u, reader.dropped() );
+  EXPECT_EQ( 0u, reader.poll( records.data(), records.size() ) );
+}
+
+TEST_F( ChangeStreamTest, readerSurvivesWriterReopen )
+{
+  uint8_t data = 0;
+  std::array<ChangeStream::Record, 8> records;
+
+  ASSERT_EQ( true, writer->open( path, 4, ChangeStream::Backpressure::DROP_NEWEST ) );
+  ChangeStream::Reader reader;
+  ASSERT_EQ( true, reader.open( path ) );
+
+  EXPECT_EQ( true, writer->push( 0, 1, &data, 1 ) );
+  writer->publish();
+  writer->close();
+
+  /*------------------------------------------------
+  Reopening resets the ring in place. Unread records from before the
+  reset are gone and the sequence starts over.
+  ------------------------------------------------*/
+  ASSERT_EQ( true, writer->open( path, 4, ChangeStream::Backpressure::DROP_NEWEST ) );
+  EXPECT_EQ( 0u, reader.poll( records.data(), records.size() ) );
+
+  EXPECT_EQ( true, writer->push( 0, 2, &data, 1 ) );
+  writer->publish();
+  ASSERT_EQ( 1u, reader.poll( records.data(), records.size() ) );
+  EXPECT_EQ( 2u, records[ 0 ].address );
+  EXPECT_EQ( 0u, records[ 0 ].sequence );
+  writer->close();
+
+  /*------------------------------------------------
+  A larger ring no longer fits the old mapping, so that reader goes
+  quiet instead of faulting and a new one picks the ring up
+  ------------------------------------------------*/
+  ASSERT_EQ( true, writer->open( path, 64, ChangeStream::Backpressure::DROP_NEWEST ) );
+  EXPECT_EQ( true, writer->push( 0, 3, &data, 1 ) );
+  writer->publish();
+  EXPECT_EQ( 0u, reader.poll( records.data(), records.size() ) );
+
+  ChangeStream::Reader reopened;
+  ASSERT_EQ( true, reopened.open( path ) );
+  ASSERT_EQ( 1u, reopened.poll( records.data(), records.size() ) );
+  EXPECT_EQ( 3u, records[ 0 ].address );
+}
+
+#endif /* !_WIN32 */
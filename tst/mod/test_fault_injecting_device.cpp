@@ -0,0 +1,189 @@
+/********************************************************************************
+ *  File Name:
+ *    test_fault_injecting_device.cpp
+ *
+ *  Description:
+ *    Tests for the fault and latency injecting device wrapper
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <array>
+#include <chrono>
+#include <memory>
+
+/* Test Driver Includes */
+#include <gtest/gtest.h>
+#include <fixtures/parameter_test_fixture.hpp>
+#include <fixtures/fault_injecting_device.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+TEST_F( PMTF, FaultInjectingDevice_passthroughByDefault )
+{
+  using namespace AeroKernel::Parameter;
+  using namespace Chimera::Modules::Memory;
+
+  uint32_t pod               = 0x12345678;
+  uint32_t readBack          = 0;
+  const std::string_view key = "pod";
+  auto faulty                = std::make_shared<FaultInjectingDevice>( ExternalSRAM0_VMD );
+
+  ControlBlockFactory factory;
+  factory.setAddress( 0x10 );
+  factory.setSize( sizeof( pod ) );
+  factory.setStorage( StorageType::EXTERNAL_SRAM0 );
+  factory.setUpdateCallback( nullptr );
+
+  pm->init( 50 );
+  pm->registerParameter( key, factory.build() );
+  pm->registerMemoryDriver( StorageType::EXTERNAL_SRAM0, faulty );
+
+  EXPECT_EQ( true, pm->write( key, &pod ) );
+  EXPECT_EQ( true, pm->read( key, &readBack ) );
+  EXPECT_EQ( pod, readBack );
+
+  auto counts = faulty->getInjectedCounts();
+  EXPECT_EQ( 2u, counts.calls );
+  EXPECT_EQ( 0u, counts.delayNs );
+  EXPECT_EQ( 0u, counts.bitFlips + counts.failedWrites + counts.partialTransfers );
+}
+
+TEST_F( PMTF, FaultInjectingDevice_failedWritesLeaveDeviceUntouched )
+{
+  using namespace AeroKernel::Parameter;
+
+  uint32_t pod               = 0xCAFEBABE;
+  uint32_t readBack          = 0;
+  const std::string_view key = "pod";
+
+  FaultInjectingDevice::Faults faults;
+  faults.writeFailureProbability = 1.0;
+  auto faulty                    = std::make_shared<FaultInjectingDevice>( InternalSRAM_VMD, faults );
+
+  ControlBlockFactory factory;
+  factory.setAddress( 0 );
+  factory.setSize( sizeof( pod ) );
+  factory.setStorage( StorageType::INTERNAL_SRAM );
+  factory.setUpdateCallback( nullptr );
+
+  pm->init( 50 );
+  pm->registerParameter( key, factory.build() );
+  pm->registerMemoryDriver( StorageType::INTERNAL_SRAM, faulty );
+
+  EXPECT_EQ( false, pm->write( key, &pod ) );
+  EXPECT_EQ( 1u, faulty->getInjectedCounts().failedWrites );
+
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK,
+             InternalSRAM_VMD->read( 0, reinterpret_cast<uint8_t *>( &readBack ), sizeof( readBack ) ) );
+  EXPECT_NE( pod, readBack );
+}
+
+TEST_F( PMTF, FaultInjectingDevice_silentPartialWrite )
+{
+  std::array<uint8_t, 16> pattern;
+  std::array<uint8_t, 16> stored;
+  pattern.fill( 0xAA );
+  stored.fill( 0x00 );
+
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, ExternalSRAM1_VMD->write( 0, stored.data(), stored.size() ) );
+
+  FaultInjectingDevice::Faults faults;
+  faults.partialTransferProbability = 1.0;
+  faults.reportPartialTransfers     = false;
+  FaultInjectingDevice faulty( ExternalSRAM1_VMD, faults );
+
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, faulty.write( 0, pattern.data(), pattern.size() ) );
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, ExternalSRAM1_VMD->read( 0, stored.data(), stored.size() ) );
+
+  EXPECT_NE( pattern.back(), stored.back() );
+  EXPECT_EQ( 1u, faulty.getInjectedCounts().partialTransfers );
+
+  /*------------------------------------------------
+  Reported partial transfers fail the call
+  ------------------------------------------------*/
+  faults.reportPartialTransfers = true;
+  faulty.setFaults( faults );
+  EXPECT_EQ( Chimera::CommonStatusCodes::FAIL, faulty.write( 0, pattern.data(), pattern.size() ) );
+}
+
+TEST_F( PMTF, FaultInjectingDevice_sameSeedSameFaults )
+{
+  std::array<uint8_t, 32> zeros;
+  std::array<uint8_t, 32> first;
+  std::array<uint8_t, 32> second;
+  zeros.fill( 0 );
+
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, ExternalSRAM0_VMD->write( 0, zeros.data(), zeros.size() ) );
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, ExternalSRAM2_VMD->write( 0, zeros.data(), zeros.size() ) );
+
+  FaultInjectingDevice::Faults faults;
+  faults.seed                   = 1234;
+  faults.readBitFlipProbability = 0.5;
+
+  FaultInjectingDevice a( ExternalSRAM0_VMD, faults );
+  FaultInjectingDevice b( ExternalSRAM2_VMD, faults );
+
+  for ( size_t x = 0; x < 20; x++ )
+  {
+    ASSERT_EQ( Chimera::CommonStatusCodes::OK, a.read( 0, first.data(), first.size() ) );
+    ASSERT_EQ( Chimera::CommonStatusCodes::OK, b.read( 0, second.data(), second.size() ) );
+    EXPECT_EQ( first, second );
+  }
+
+  EXPECT_GT( a.getInjectedCounts().bitFlips, 0u );
+  EXPECT_EQ( a.getInjectedCounts().bitFlips, b.getInjectedCounts().bitFlips );
+
+  /*------------------------------------------------
+  The stored data itself was never corrupted
+  ------------------------------------------------*/
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, ExternalSRAM0_VMD->read( 0, first.data(), first.size() ) );
+  EXPECT_EQ( zeros, first );
+}
+
+TEST_F( PMTF, FaultInjectingDevice_seedReplaysKnownFaults )
+{
+  /*------------------------------------------------
+  Which reads of zeros come back with a flipped bit, and where, for seed
+  1234. Fixed by the mt19937_64 definition, so this holds on any standard
+  library.
+  ------------------------------------------------*/
+  static constexpr std::array<uint32_t, 12> expected = { 0x2, 0x1, 0x40, 0, 0, 0, 0x2, 0, 0, 0x200, 0, 0x8 };
+
+  std::array<uint8_t, 4> data;
+  data.fill( 0 );
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, ExternalSRAM0_VMD->write( 0, data.data(), data.size() ) );
+
+  FaultInjectingDevice::Faults faults;
+  faults.seed                   = 1234;
+  faults.readBitFlipProbability = 0.5;
+  FaultInjectingDevice faulty( ExternalSRAM0_VMD, faults );
+
+  for ( size_t x = 0; x < expected.size(); x++ )
+  {
+    ASSERT_EQ( Chimera::CommonStatusCodes::OK, faulty.read( 0, data.data(), data.size() ) );
+
+    const uint32_t value = data[ 0 ] | ( data[ 1 ] << 8 ) | ( data[ 2 ] << 16 ) | ( static_cast<uint32_t>( data[ 3 ] ) << 24 );
+    EXPECT_EQ( expected[ x ], value ) << "read " << x;
+  }
+}
+
+TEST_F( PMTF, FaultInjectingDevice_addsLatency )
+{
+  using namespace std::chrono;
+
+  uint8_t data = 0;
+
+  FaultInjectingDevice::Faults faults;
+  faults.latencyNs = 200000;
+  FaultInjectingDevice faulty( InternalSRAM_VMD, faults );
+
+  auto start = steady_clock::now();
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, faulty.read( 0, &data, 1 ) );
+  auto elapsed = duration_cast<nanoseconds>( steady_clock::now() - start ).count();
+
+  EXPECT_GE( elapsed, 200000 );
+  EXPECT_EQ( 200000u, faulty.getInjectedCounts().delayNs );
+}
@@ -0,0 +1,156 @@
+/********************************************************************************
+ *  File Name:
+ *    test_fram_device_model.cpp
+ *
+ *  Description:
+ *    Tests for the host side SPI F-RAM timing model
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <chrono>
+#include <cstring>
+#include <memory>
+
+/* Test Driver Includes */
+#include <gtest/gtest.h>
+#include <fixtures/parameter_test_fixture.hpp>
+#include <fixtures/fram_device_model.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+/**
+ *  Same layout as the structure used by the on-target F-RAM integration test
+ */
+struct FRAMDataType
+{
+  float a1;
+  uint32_t b1;
+  uint64_t c1;
+  uint8_t d1;
+};
+
+TEST_F( PMTF, FRAMDeviceModel_transactionTime )
+{
+  FRAMDeviceModel::Timing timing;
+  timing.clockFrequency = 8000000;
+  timing.transactionNs  = 250;
+
+  FRAMDeviceModel fram( ExternalSRAM2_VMD, timing );
+
+  /* 8 MHz clocks one byte per microsecond */
+  EXPECT_EQ( 250u, fram.transactionTimeNs( 0 ) );
+  EXPECT_EQ( 1250u, fram.transactionTimeNs( 1 ) );
+  EXPECT_EQ( 13250u, fram.transactionTimeNs( 13 ) );
+}
+
+TEST_F( PMTF, FRAMDeviceModel_chargesProtocolOverhead )
+{
+  uint8_t data[ 10 ];
+  memset( data, 0x5A, sizeof( data ) );
+
+  FRAMDeviceModel fram( ExternalSRAM2_VMD );
+
+  /*------------------------------------------------
+  Write: WREN (1 byte) + WRITE opcode, 2 address bytes, 10 data bytes
+  ------------------------------------------------*/
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, fram.write( 0, data, sizeof( data ) ) );
+
+  auto stats = fram.getBusStats();
+  EXPECT_EQ( 2u, stats.transactions );
+  EXPECT_EQ( 14u, stats.busBytes );
+  EXPECT_EQ( 10u, stats.payloadBytes );
+  EXPECT_EQ( 14000u, stats.busTimeNs );
+
+  /*------------------------------------------------
+  Read: READ opcode, 2 address bytes, 10 data bytes
+  ------------------------------------------------*/
+  fram.resetCounters();
+  memset( data, 0, sizeof( data ) );
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, fram.read( 0, data, sizeof( data ) ) );
+  EXPECT_EQ( 0x5A, data[ 9 ] );
+
+  stats = fram.getBusStats();
+  EXPECT_EQ( 1u, stats.transactions );
+  EXPECT_EQ( 13u, stats.busBytes );
+  EXPECT_EQ( 13000u, stats.busTimeNs );
+}
+
+TEST_F( PMTF, FRAMDeviceModel_zeroClockUsesDefault )
+{
+  FRAMDeviceModel::Timing timing;
+  timing.clockFrequency = 0;
+
+  FRAMDeviceModel fram( ExternalSRAM2_VMD, timing );
+  EXPECT_EQ( 1000u, fram.transactionTimeNs( 1 ) );
+}
+
+TEST_F( PMTF, FRAMDeviceModel_rejectedAccessNotCharged )
+{
+  uint8_t data = 0;
+  FRAMDeviceModel fram( ExternalSRAM2_VMD );
+
+  const size_t pastEnd = getVirtualMemorySize( AeroKernel::Parameter::StorageType::EXTERNAL_SRAM2 );
+
+  EXPECT_NE( Chimera::CommonStatusCodes::OK, fram.write( pastEnd, &data, 1 ) );
+  EXPECT_NE( Chimera::CommonStatusCodes::OK, fram.read( pastEnd, &data, 1 ) );
+
+  auto stats = fram.getBusStats();
+  EXPECT_EQ( 2u, stats.failed );
+  EXPECT_EQ( 0u, stats.transactions );
+  EXPECT_EQ( 0u, stats.busBytes );
+  EXPECT_EQ( 0u, stats.busTimeNs );
+}
+
+TEST_F( PMTF, FRAMDeviceModel_realTimeDelay )
+{
+  using namespace std::chrono;
+
+  uint8_t data[ 100 ];
+  FRAMDeviceModel::Timing timing;
+  timing.realTime = true;
+
+  FRAMDeviceModel fram( ExternalSRAM2_VMD, timing );
+
+  auto start = steady_clock::now();
+  fram.read( 0, data, sizeof( data ) );
+  auto elapsed = duration_cast<nanoseconds>( steady_clock::now() - start ).count();
+
+  EXPECT_GE( static_cast<uint64_t>( elapsed ), fram.getBusStats().busTimeNs );
+}
+
+TEST_F( PMTF, FRAMDeviceModel_readWriteThroughManager )
+{
+  using namespace AeroKernel::Parameter;
+  using namespace Chimera::Modules::Memory;
+
+  const std::string_view key = "testStructure";
+  auto fram                  = std::make_shared<FRAMDeviceModel>( ExternalSRAM2_VMD );
+  Device_sPtr driver         = fram;
+
+  FRAMDataType testParam;
+  testParam.a1 = 3.14159f;
+  testParam.b1 = 0x12345678;
+  testParam.c1 = 0xFF00FF00FF00FF00;
+  testParam.d1 = 0xAA;
+
+  FRAMDataType testParamCopy;
+  memset( &testParamCopy, 0, sizeof( FRAMDataType ) );
+
+  ControlBlockFactory factory;
+  factory.setAddress( 0x0000 );
+  factory.setSize( sizeof( FRAMDataType ) );
+  factory.setStorage( StorageType::EXTERNAL_FLASH0 );
+  factory.setUpdateCallback( nullptr );
+
+  pm->init( 50 );
+  pm->registerParameter( key, factory.build() );
+  pm->registerMemoryDriver( StorageType::EXTERNAL_FLASH0, driver );
+
+  EXPECT_EQ( true, pm->write( key, &testParam ) );
+  EXPECT_EQ( true, pm->read( key, &testParamCopy ) );
+  EXPECT_EQ( 0, memcmp( &testParam, &testParamCopy, sizeof( FRAMDataType ) ) );
+  EXPECT_EQ( 2 * sizeof( FRAMDataType ), fram->getBusStats().payloadBytes );
+}
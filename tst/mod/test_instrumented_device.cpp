@@ -0,0 +1,85 @@
+/********************************************************************************
+ *  File Name:
+ *    test_instrumented_device.cpp
+ *
+ *  Description:
+ *    Tests for the driver operation counters used to profile the Parameter Manager
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <memory>
+
+/* Test Driver Includes */
+#include <gtest/gtest.h>
+#include <fixtures/parameter_test_fixture.hpp>
+#include <fixtures/instrumented_device.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+TEST_F( PMTF, InstrumentedDevice_countsManagerTraffic )
+{
+  using namespace AeroKernel::Parameter;
+  using namespace Chimera::Modules::Memory;
+
+  uint32_t pod               = 0x12345678;
+  const std::string_view key = "pod";
+  auto instrumented          = std::make_shared<InstrumentedDevice>( InternalSRAM_VMD );
+  Device_sPtr driver         = instrumented;
+
+  ControlBlockFactory factory;
+  factory.setAddress( 0x10 );
+  factory.setSize( sizeof( pod ) );
+  factory.setStorage( StorageType::INTERNAL_SRAM );
+  factory.setUpdateCallback( nullptr );
+
+  pm->init( 50 );
+  pm->registerParameter( key, factory.build() );
+  pm->registerMemoryDriver( StorageType::INTERNAL_SRAM, driver );
+
+  EXPECT_EQ( true, pm->write( key, &pod ) );
+  EXPECT_EQ( true, pm->read( key, &pod ) );
+  EXPECT_EQ( true, pm->read( key, &pod ) );
+
+  auto stats = instrumented->getStats();
+  EXPECT_EQ( 1u, stats.write.count );
+  EXPECT_EQ( sizeof( pod ), stats.write.bytes );
+  EXPECT_EQ( 2u, stats.read.count );
+  EXPECT_EQ( 2 * sizeof( pod ), stats.read.bytes );
+  EXPECT_EQ( 0u, stats.erase.count );
+  EXPECT_EQ( 0u, stats.read.errors + stats.write.errors );
+  EXPECT_LE( stats.read.maxNs, stats.read.totalNs );
+}
+
+TEST_F( PMTF, InstrumentedDevice_countsDriverErrors )
+{
+  uint8_t data      = 0;
+  auto instrumented = std::make_shared<InstrumentedDevice>( InternalSRAM_VMD );
+
+  const size_t pastEnd = getVirtualMemorySize( AeroKernel::Parameter::StorageType::INTERNAL_SRAM );
+
+  EXPECT_NE( Chimera::CommonStatusCodes::OK, instrumented->write( pastEnd, &data, 1 ) );
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, instrumented->write( 0, &data, 1 ) );
+
+  auto stats = instrumented->getStats();
+  EXPECT_EQ( 2u, stats.write.count );
+  EXPECT_EQ( 1u, stats.write.errors );
+}
+
+TEST_F( PMTF, InstrumentedDevice_resetStats )
+{
+  uint8_t data      = 0;
+  auto instrumented = std::make_shared<InstrumentedDevice>( InternalSRAM_VMD );
+
+  instrumented->read( 0, &data, 1 );
+  instrumented->erase( 0, 1 );
+  instrumented->resetStats();
+
+  auto stats = instrumented->getStats();
+  EXPECT_EQ( 0u, stats.read.count );
+  EXPECT_EQ( 0u, stats.erase.count );
+  EXPECT_EQ( 0u, stats.read.totalNs );
+  EXPECT_EQ( 0u, stats.read.maxNs );
+}
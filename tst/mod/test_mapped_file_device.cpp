@@ -0,0 +1,176 @@
+/********************************************************************************
+ *  File Name:
+ *    test_mapped_file_device.cpp
+ *
+ *  Description:
+ *    Tests for the memory mapped file storage backend used by host simulations
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+#if !defined( _WIN32 )
+
+/* C++ Includes */
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* POSIX Includes */
+#include <unistd.h>
+
+/* Test Driver Includes */
+#include <gtest/gtest.h>
+#include <fixtures/parameter_test_fixture.hpp>
+#include <fixtures/mapped_file_device.hpp>
+
+/* API Under Test */
+#include <AeroKernel/parameter.hpp>
+
+static constexpr size_t MappedFileSize = 16 * KB;
+
+class MappedFileTest : public PMTF
+{
+protected:
+  virtual void SetUp() override
+  {
+    PMTF::SetUp();
+
+    char name[] = "/tmp/aerokernel_mmap_XXXXXX";
+    int fd      = mkstemp( name );
+    ASSERT_GE( fd, 0 );
+    ::close( fd );
+
+    path       = name;
+    pageSize   = static_cast<size_t>( sysconf( _SC_PAGESIZE ) );
+    deviceSize = std::max( MappedFileSize, 4 * pageSize );
+  }
+
+  virtual void TearDown() override
+  {
+    unlink( path.c_str() );
+    PMTF::TearDown();
+  }
+
+  std::string path;
+  size_t pageSize;   /**< Host page size, so page crossing tests cross on any host */
+  size_t deviceSize; /**< At least four pages */
+};
+
+TEST_F( MappedFileTest, operationsBeforeOpen )
+{
+  uint8_t data = 0;
+  MappedFileDevice device;
+
+  EXPECT_EQ( false, device.isInitialized() );
+  EXPECT_EQ( Chimera::CommonStatusCodes::NOT_INITIALIZED, device.write( 0, &data, 1 ) );
+  EXPECT_EQ( Chimera::CommonStatusCodes::NOT_INITIALIZED, device.read( 0, &data, 1 ) );
+  EXPECT_EQ( Chimera::CommonStatusCodes::NOT_INITIALIZED, device.flush() );
+}
+
+TEST_F( MappedFileTest, outOfBounds )
+{
+  uint8_t data = 0;
+  MappedFileDevice device;
+
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, device.open( path, MappedFileSize ) );
+  EXPECT_NE( Chimera::CommonStatusCodes::OK, device.write( MappedFileSize, &data, 1 ) );
+  EXPECT_NE( Chimera::CommonStatusCodes::OK, device.read( MappedFileSize - 1, &data, 2 ) );
+  EXPECT_NE( Chimera::CommonStatusCodes::OK, device.erase( 0, MappedFileSize + 1 ) );
+}
+
+TEST_F( MappedFileTest, newImageReadsErased )
+{
+  MappedFileDevice device;
+
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, device.open( path, deviceSize ) );
+  EXPECT_EQ( MappedFileDevice::ErasedValue, device.data()[ 0 ] );
+  EXPECT_EQ( MappedFileDevice::ErasedValue, device.data()[ deviceSize - 1 ] );
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, device.close() );
+
+  /*------------------------------------------------
+  Growing an existing image erases only the new bytes
+  ------------------------------------------------*/
+  uint8_t data = 0x5A;
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, device.open( path, deviceSize ) );
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, device.write( deviceSize - 1, &data, 1 ) );
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, device.close() );
+
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, device.open( path, deviceSize + pageSize ) );
+  EXPECT_EQ( data, device.data()[ deviceSize - 1 ] );
+  EXPECT_EQ( MappedFileDevice::ErasedValue, device.data()[ deviceSize ] );
+  EXPECT_EQ( MappedFileDevice::ErasedValue, device.data()[ deviceSize + pageSize - 1 ] );
+}
+
+TEST_F( MappedFileTest, eraseAcrossPages )
+{
+  MappedFileDevice device;
+  std::vector<uint8_t> zeros( deviceSize, 0x00 );
+
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, device.open( path, deviceSize ) );
+  ASSERT_EQ( Chimera::CommonStatusCodes::OK, device.write( 0, zeros.data(), zeros.size() ) );
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, device.erase( 10, deviceSize - 20 ) );
+  EXPECT_EQ( Chimera::CommonStatusCodes::OK, device.flush() );
+
+  EXPECT_EQ( 0x00, device.data()[ 9 ] );
+  EXPECT_EQ( MappedFileDevice::ErasedValue, device.data()[ 10 ] );
+  EXPECT_EQ( MappedFileDevice::ErasedValue, device.data()[ deviceSize - 11 ] );
+  EXPECT_EQ( 0x00, device.data()[ deviceSize - 10 ] );
+}
+
+TEST_F( MappedFileTest, parametersPersistAcrossRuns )
+{
+  using namespace AeroKernel::Parameter;
+  using namespace Chimera::Modules::Memory;
+
+  uint64_t pod               = 0x0123456789ABCDEF;
+  const std::string_view key = "persisted";
+
+  /*------------------------------------------------
+  Half the value lands on each side of the second page boundary
+  ------------------------------------------------*/
+  ControlBlockFactory factory;
+  factory.setAddress( ( 2 * pageSize ) - ( sizeof( pod ) / 2 ) );
+  factory.setSize( sizeof( pod ) );
+  factory.setStorage( StorageType::EXTERNAL_FLASH0 );
+  factory.setUpdateCallback( nullptr );
+
+  /*------------------------------------------------
+  First run writes the parameter
+  ------------------------------------------------*/
+  {
+    auto device        = std::make_shared<MappedFileDevice>();
+    Device_sPtr driver = device;
+    ASSERT_EQ( Chimera::CommonStatusCodes::OK, device->open( path, deviceSize ) );
+
+    pm->init( 50 );
+    pm->registerParameter( key, factory.build() );
+    pm->registerMemoryDriver( StorageType::EXTERNAL_FLASH0, driver );
+
+    EXPECT_EQ( true, pm->write( key, &pod ) );
+    EXPECT_EQ( Chimera::CommonStatusCodes::OK, device->close() );
+  }
+
+  /*------------------------------------------------
+  Second run maps the same file and reads it back with no load step
+  ------------------------------------------------*/
+  {
+    delete pm;
+    pm = new AeroKernel::Parameter::Manager();
+
+    auto device        = std::make_shared<MappedFileDevice>();
+    Device_sPtr driver = device;
+    ASSERT_EQ( Chimera::CommonStatusCodes::OK, device->open( path, deviceSize ) );
+
+    pm->init( 50 );
+    pm->registerParameter( key, factory.build() );
+    pm->registerMemoryDriver( StorageType::EXTERNAL_FLASH0, driver );
+
+    uint64_t readBack = 0;
+    EXPECT_EQ( true, pm->read( key, &readBack ) );
+    EXPECT_EQ( pod, readBack );
+  }
+}
+
+#endif /* !_WIN32 */
@@ -0,0 +1,106 @@
+/********************************************************************************
+ *  File Name:
+ *    test_trace_recorder.cpp
+ *
+ *  Description:
+ *    Tests for the host profiling trace recorder
+ *
+ *  2026 | Brandon Braun | brandonbraun653@gmail.com
+ ********************************************************************************/
+
+/* C++ Includes */
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Test Driver Includes */
+#include <gtest/gtest.h>
+
+/* API Under Test */
+#include <fixtures/trace_recorder.hpp>
+
+TEST( TraceRecorder, zoneRecordsOnDestruction )
+{
+  AeroKernel::Trace::initialize( 4 );
+
+  {
+    AeroKernel::Trace::Zone zone( "outer" );
+    EXPECT_EQ( 0u, AeroKernel::Trace::records().size() );
+  }
+
+  auto records = AeroKernel::Trace::records();
+  ASSERT_EQ( 1u, records.size() );
+  EXPECT_STREQ( "outer", records[ 0 ].name );
+  EXPECT_LE( records[ 0 ].startNs, AeroKernel::Trace::now() );
+}
+
+TEST( TraceRecorder, dropsWhenFull )
+{
+  AeroKernel::Trace::initialize( 2 );
+
+  for ( int i = 0; i < 5; i++ )
+  {
+    AeroKernel::Trace::record( "zone", 10, 20 );
+  }
+
+  EXPECT_EQ( 2u, AeroKernel::Trace::records().size() );
+  EXPECT_EQ( 3u, AeroKernel::Trace::dropped() );
+  EXPECT_EQ( 10u, AeroKernel::Trace::records()[ 1 ].durationNs );
+}
+
+TEST( TraceRecorder, chromeTraceFormat )
+{
+  AeroKernel::Trace::initialize( 2 );
+  AeroKernel::Trace::record( "Manager::read", 1500, 4000 );
+
+  std::stringstream json;
+  AeroKernel::Trace::writeChromeTrace( json );
+
+  const std::string doc = json.str();
+  EXPECT_NE( std::string::npos, doc.find( "\"traceEvents\":[" ) );
+  EXPECT_NE( std::string::npos, doc.find( "\"name\":\"Manager::read\",\"ph\":\"X\"" ) );
+  EXPECT_NE( std::string::npos, doc.find( "\"ts\":1.500,\"dur\":2.500" ) );
+}
+
+TEST( TraceRecorder, chromeTraceEscapesNames )
+{
+  AeroKernel::Trace::initialize( 2 );
+  AeroKernel::Trace::record( "say \"hi\"\\\n", 0, 1 );
+
+  std::stringstream json;
+  AeroKernel::Trace::writeChromeTrace( json );
+
+  EXPECT_NE( std::string::npos, json.str().find( "\"name\":\"say \\\"hi\\\"\\\\\\u000a\"" ) );
+}
+
+TEST( TraceRecorder, reinitializeWhileRecording )
+{
+  std::atomic<bool> stop( false );
+  AeroKernel::Trace::initialize( 16 );
+
+  std::vector<std::thread> recorders;
+  for ( int i = 0; i < 4; i++ )
+  {
+    recorders.emplace_back( [ &stop ]() {
+      while ( !stop.load() )
+      {
+        AeroKernel::Trace::record( "zone", 0, 1 );
+      }
+    } );
+  }
+
+  for ( int i = 0; i < 200; i++ )
+  {
+    AeroKernel::Trace::initialize( 1 + ( i % 16 ) );
+  }
+
+  stop.store( true );
+  for ( auto &thread : recorders )
+  {
+    thread.join();
+  }
+
+  EXPECT_LE( AeroKernel::Trace::records().size(), 16u );
+}